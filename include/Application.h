@@ -23,6 +23,7 @@
 #include "SoundHandler.h"
 #include "Sprite.h"
 #include "Text.h"
+#include "Timeline.h"
 #include "TitleScreen.h"
 
 #ifdef _WIN32
@@ -0,0 +1,102 @@
+/*******************************************************************************
+ * Class Name: AssetPack
+ * Date Created: October 19, 2026
+ * Inheritance: none
+ * Description: A single indexed archive of the game assets. The pack is mapped
+ *              into memory once and each asset opens from it as a SDL_RWops,
+ *              so loading does not open or stat a file per asset. Images are
+ *              stored decoded and skip the image decode as well. Any asset not
+ *              in the pack loads from the loose file as before.
+ ******************************************************************************/
+#ifndef ASSETPACK_H
+#define ASSETPACK_H
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_image.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <future>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/* A single asset within the pack */
+struct AssetPackEntry
+{
+  /* The offset from the start of the pack and the size, in bytes */
+  uint64_t offset;
+  uint64_t size;
+
+  /* The pixel format of a decoded image. 0 if the entry is the file data */
+  uint32_t format;
+
+  /* The size of a decoded image, in pixels */
+  uint32_t width;
+  uint32_t height;
+};
+
+class AssetPack
+{
+private:
+  /* The base path that the pack asset paths are relative to */
+  static std::string base_path;
+
+  /* The pack data, mapped (or read in, where mapping is not available) */
+  static uint8_t* data;
+  static uint64_t data_size;
+  static bool data_mapped;
+
+  /* The index of the pack, by the asset path relative to the base path */
+  static std::unordered_map<std::string, AssetPackEntry> entries;
+
+  /* Images being decoded ahead of use on worker threads, by path */
+  static std::unordered_map<std::string, std::future<SDL_Surface*>> prefetched;
+
+  /* -------------------------- Constants ------------------------- */
+  const static std::string kIMAGE_EXT; /* The file extension stored decoded */
+  const static std::string kMAGIC; /* The identifier at the start of a pack */
+
+public:
+  const static std::string kPACK_FILE; /* The pack name, in the base path */
+
+/*======================== PRIVATE FUNCTIONS ===============================*/
+private:
+  /* Decodes the image at the path. Safe to call on a worker thread */
+  static SDL_Surface* decodeImage(const std::string& path);
+
+  /* Returns the entry for the asset path. Null if not in the pack */
+  static const AssetPackEntry* findEntry(const std::string& path);
+
+  /* Appends the paths of all files under the directory, sorted */
+  static void listFiles(const std::string& base, const std::string& dir,
+                        std::vector<std::string>& files);
+
+/*========================= PUBLIC FUNCTIONS ===============================*/
+public:
+  /* Builds a pack of all the files under the directory of the base path */
+  static bool build(const std::string& base, const std::string& dir,
+                    const std::string& pack_path);
+
+  /* Returns if a pack is mounted */
+  static bool isMounted();
+
+  /* Loads the image at the path, from the pack or from the loose file */
+  static SDL_Surface* loadImage(const std::string& path);
+
+  /* Mounts the pack, with asset paths relative to the base path */
+  static bool mount(const std::string& base, const std::string& pack_path);
+
+  /* Opens a read stream of the asset in the pack. Null if not packed */
+  static SDL_RWops* openFile(const std::string& path);
+
+  /* Starts decoding the image at the path on a worker, for loadImage */
+  static void prefetchImage(const std::string& path);
+
+  /* Unmounts the pack and drops prefetched images. All streams opened from
+   * it must be closed first */
+  static void unmount();
+};
+
+#endif // ASSETPACK_H
@@ -501,28 +501,41 @@ enum class LayType
 };
 
 /*
- *   ----------------------
- *   |      |      |      |
- *   |  NW  |  N   |  NE  |
- *   |______|______|______|
- *   |      |      |      |
- *   |  W   |  C   |  E   |
- *   |______|______|______|
- *   |      |      |      |
- *   |  SW  |  S   |  SE  |
- *   |______|______|______|
- */
-enum class LayIndex
-{
-  NORTH_WEST = 1,
-  NORTH = 2,
-  NORTH_EAST = 3,
-  WEST = 4,
-  CENTRE = 5,
-  EAST = 6,
-  SOUTH_WEST = 7,
-  SOUTH = 8,
-  SOUTH_EAST = 9
+ * Description: The subsystem a log message comes from. Each has its own
+ *              run-time level filter.
+ *
+ * GENERAL - application and game wide messages
+ * AI - the battle AI decisions
+ * BATTLE - the battle flow, buffer, events and stats
+ * MAP - the map and its things
+ * COUNT - the number of categories (not a category)
+ */
+enum class LogCategory : std::uint8_t
+{
+  GENERAL,
+  AI,
+  BATTLE,
+  MAP,
+  COUNT
+};
+
+/*
+ * Description: The severity of a log message, lowest to highest. A message is
+ *              only written if at or above the level of its category.
+ *
+ * DEBUG - detailed tracing, off by default
+ * INFO - general progress
+ * WARNING - unexpected but recoverable
+ * FAULT - an error (not named ERROR, which windows.h defines as a macro)
+ * NONE - as a filter level, writes nothing
+ */
+enum class LogLevel : std::uint8_t
+{
+  DEBUG,
+  INFO,
+  WARNING,
+  FAULT,
+  NONE
 };
 
 /*
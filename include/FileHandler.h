@@ -115,6 +115,7 @@ private:
   const static int kMAX_ASCII;       /* Max ascii out of bounds */
   const static int kMIN_LINE;        /* Minimum line length for encryption */
   const static int kPADDING_ASCII;   /* Start of padding characters */
+  const static std::string kSNAPSHOT_TEMP; /* Snapshot temp file suffix */
   const static int kXXTEA_ROUNDS;    /* Number of rounds for encryption */
 
 /*======================== PRIVATE FUNCTIONS ===============================*/
@@ -205,6 +206,10 @@ public:
   /* Returns the file type that's used for reading from and writing to */
   FileType getFileType();
 
+  /* Returns the write set as the XML output, stamped with a new date. Used
+   * with writeXmlSnapshot() to write the file off of the calling thread */
+  std::string getXmlSnapshot();
+
   /* Determines if the class is available for using (ie. stream opened) */
   bool isAvailable();
 
@@ -225,6 +230,10 @@ public:
    * done */
   XmlData readXmlData(bool* done = nullptr, bool* success = nullptr);
 
+  /* Finds the element in the stack (not including data entry) and then removes
+   * it, with all children. The location is saved to the parent */
+  bool removeElement(XmlData data, bool save_location = false);
+
   /* Save - triggers the write to file without closing the document */
   bool save();
 
@@ -243,6 +252,11 @@ public:
   /* Starts the whole process, to be able to access the file stream */
   bool start(bool read_before_write = false);
 
+  /* Starts an XML write of the document only, read from the file if it
+   * exists and read_file is set. No stream is opened - write it with
+   * getXmlSnapshot() */
+  bool startDocument(bool read_file = true);
+
   /* Stops the whole process, to end access to the file stream */
   bool stop(bool failed = false);
 
@@ -294,6 +308,11 @@ public:
 
   /* Returns the current date in a string form as per std::strftime */
   static std::string getCurrentDate(std::string format = "%Y/%m/%d %H:%M:%S");
+
+  /* Writes the XML output (from getXmlSnapshot) to the file. Safe to call
+   * from a worker thread */
+  static bool writeXmlSnapshot(std::string filename, std::string output,
+                               bool encryption = false);
 };
 
 #endif // FILEHANDLER_H
@@ -14,10 +14,14 @@
 #include <SDL2/SDL_image.h>
 #include <cmath>
 #include <cstdio>
+#include <cstring>
 #include <iostream>
+#include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
+#include "AssetPack.h"
 #include "Helpers.h"
 
 #include "SDL2_gfxPrimitives.h"
@@ -48,6 +52,9 @@ private:
   /* The stored alpha value for rendering */
   uint8_t alpha;
 
+  /* The angle the loaded image was rotated by */
+  uint16_t angle;
+
   /* The frame control color mode */
   uint8_t color_alpha;
   ColorMode color_mode;
@@ -55,6 +62,10 @@ private:
   /* How the SDL texture should be flipped while rendering */
   SDL_RendererFlip flip;
 
+  /* The greyscale texture is created on first use, with this renderer */
+  bool grey_enabled;
+  SDL_Renderer* grey_renderer;
+
   /* The height of the stored texture */
   int height;
 
@@ -73,17 +84,29 @@ private:
 
   /* The texture for this frame */
   SDL_Texture* texture;
-  SDL_Texture* texture_grey;
+  std::shared_ptr<SDL_Texture> texture_grey;
 
   /* The width of the stored texture */
   int width;
 
+  /* The fill rects batched between batchBegin() and batchEnd() */
+  static std::vector<SDL_Rect> batch_rects;
+  static uint16_t batch_depth;
+
+  /* The greyscale textures shared by all frames, by path and angle */
+  static std::map<std::string, std::weak_ptr<SDL_Texture>> grey_cache;
+
   /*------------------- Private Constants -----------------------*/
   const static uint8_t kDEFAULT_ALPHA; /* The default alpha rating */
   const static float kGREY_FOR_BLUE;   /* Grey scale convert for blue factor */
   const static float kGREY_FOR_GREEN;  /* Grey scale convert for green factor */
   const static float kGREY_FOR_RED;    /* Grey scale convert for red factor */
 
+  /*======================== PRIVATE FUNCTIONS ===============================*/
+private:
+  /* Creates the greyscale texture, if enabled and not yet created */
+  bool createGrey();
+
   /*========================= PUBLIC FUNCTIONS ===============================*/
 public:
   /* Executes the necessary image adjustments, as per the file data handlers */
@@ -162,6 +185,18 @@ private:
   static void drawLineY(int32_t y1, int32_t y2, int32_t x,
                         SDL_Renderer* renderer);
 
+  /* Draws a single point, added to the rect batch if one is open */
+  static void drawPoint(int32_t x, int32_t y, SDL_Renderer* renderer);
+
+  /* Fills the rect, added to the rect batch if one is open */
+  static void fillRect(const SDL_Rect& rect, SDL_Renderer* renderer);
+
+  /* Converts all 32 bit pixels of the surface to greyscale, in place */
+  static void greyPixels(SDL_Surface* surface);
+
+  /* Loads the image and rotates it by the angle (mod 90, square only) */
+  static SDL_Surface* loadSurface(const std::string& path, uint16_t angle);
+
   /* Render bottom flat triangle - handled by renderTriangle() */
   static void renderBottomFlatTriangle(uint16_t x1, uint16_t x2, uint16_t x3,
                                        uint16_t y1, uint16_t y23,
@@ -174,8 +209,17 @@ private:
                                     SDL_Renderer* renderer, bool aliasing,
                                     bool flat_side = false);
 
+  /* Rotates the 32 bit pixels of the square surface by the angle */
+  static void rotatePixels(SDL_Surface* surface, uint16_t angle);
+
   /*===================== PUBLIC STATIC  FUNCTIONS ===========================*/
 public:
+  /* Opens a rect batch. Nested batches flush with the outermost batchEnd() */
+  static void batchBegin();
+
+  /* Closes a rect batch and flushes all batched rects in one draw call */
+  static void batchEnd(SDL_Renderer* renderer);
+
   /* Draws a line given a vector of coordinates */
   static void drawLine(std::vector<Coordinate> line_points,
                        SDL_Renderer* renderer);
@@ -97,8 +97,9 @@ private:
   uint32_t delay_curr;
   uint32_t delay_next;
 
-  /* The current battle event */
+  /* The current battle event, and the event object reused for each action */
   BattleEvent* event;
+  BattleEvent* event_store;
 
   /* The event handler for the game */
   EventHandler* eh;
@@ -109,6 +110,10 @@ private:
   /* Flags related to the render state */
   RenderState flags_render;
 
+  /* The damage value digit strip, and the rect of each digit within it */
+  Frame* frame_digits;
+  std::vector<SDL_Rect> frame_digits_rects;
+
   /* The enemy backdrop frame */
   Frame* frame_enemy_backdrop;
 
@@ -131,6 +136,9 @@ private:
   /* Render element objects for the Battle */
   std::vector<RenderElement*> render_elements;
 
+  /* Render elements that are done, kept to be reused by createElement() */
+  std::vector<RenderElement*> render_pool;
+
   /* The turn state of the Battle */
   TurnState turn_state;
 
@@ -275,6 +283,9 @@ private:
   /* Clears the Battle event if built */
   void clearEvent();
 
+  /* Returns a pooled (or new) render element, reset with the given font */
+  RenderElement* createElement(TTF_Font* font = nullptr);
+
   /* Creates a DamageElement RenderElement type on th given actor */
   void createDamageElement(
       BattleActor* actor, DamageType damage_type, uint32_t amount);
@@ -410,6 +421,9 @@ private:
   /* Creates action frames for a given BattleActor */
   void buildActionFrame(BattleActor* actor);
 
+  /* Creates the digit strip for rendering damage values */
+  void buildDigits();
+
   /* Creates the enemy backdrop frame */
   void buildEnemyBackdrop();
 
@@ -419,11 +433,18 @@ private:
   /* Creates an enemy info for a given BattleActor */
   void buildInfoEnemy(BattleActor* enemy);
 
+  /* Composites the info with the bars and amounts, if the values changed */
+  void buildInfoValues(BattleActor* actor);
+
   /* Clears the Battle background */
   void clearBackground();
 
-  /* Clears the elements out */
+  /* Clears the damage value digit strip */
+  void clearDigits();
+
+  /* Clears the elements out (into the pool, which is deleted on its own) */
   void clearElements();
+  void clearElementsPooled();
   void clearElementsTimedOut();
 
   /* Clears Enemy Backdrop */
@@ -447,6 +468,11 @@ private:
   bool renderAllies();
   bool renderAlliesInfo();
   bool renderAllyInfo(BattleActor* ally, bool for_menu = false);
+  bool renderAllyInfoValues(BattleActor* ally);
+
+  /* Renders a value from the digit strip */
+  bool renderDigits(std::string value, SDL_Color color, uint8_t alpha,
+                    int32_t x, int32_t y);
 
   bool renderElements();
   void renderElementPlep(RenderElement* element);
@@ -456,6 +482,7 @@ private:
   /* Enemy rendering functions */
   bool renderEnemies();
   bool renderEnemiesInfo();
+  bool renderEnemyInfoValues(BattleActor* enemy);
 
   /* Render midlays */
   void renderMidlays();
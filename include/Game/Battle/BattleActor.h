@@ -186,12 +186,21 @@ private:
   /* Vector of Battle skills */
   std::vector<BattleSkill*> battle_skills;
 
+  /* Pools that own the battle items and skills, reused across turns. The
+   * vectors above point to the front of the pools that was built this turn */
+  std::vector<BattleItem*> pool_battle_items;
+  std::vector<BattleSkill*> pool_battle_skills;
+
   /* Flags for the actor */
   ActorState flags;
 
   /* The info frame for the Battle Actor */
   Frame* frame_info;
 
+  /* The info frame with the bars and amounts, and the values it shows */
+  Frame* frame_info_values;
+  std::vector<uint32_t> info_values;
+
   /* The menu index. [- for enemies, + for allies] */
   int32_t menu_index;
 
@@ -385,6 +394,10 @@ public:
   /* Pointer to the info frame */
   Frame* getInfoFrame();
 
+  /* Pointer to the info frame with values, and the values it was built on */
+  Frame* getInfoValuesFrame();
+  const std::vector<uint32_t>& getInfoValues();
+
   /* Returns the sprite for the dialog (for action frames) */
   Sprite* getDialogSprite();
 
@@ -454,6 +467,10 @@ public:
   /* Assigns a new info frame to the Battle Actor */
   void setInfoFrame(Frame* info_frame);
 
+  /* Assigns a new info frame with values, built on the given values */
+  void setInfoValuesFrame(Frame* frame_info_values,
+                          std::vector<uint32_t> info_values);
+
   /* Assigns a selection state */
   void setSelectionState(SelectionState state_selection);
 
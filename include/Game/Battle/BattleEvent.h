@@ -237,11 +237,11 @@ private:
   // int32_t calcValPhysPow();
   // int32_t calcValPhysDef(BattleStats target_stats);
   int32_t calcValPrimAtk(Skill* curr_skill);
-  int32_t calcValPrimDef(Skill* curr_skill, BattleStats target_stats);
+  int32_t calcValPrimDef(Skill* curr_skill, const BattleStats& target_stats);
   int32_t calcValSecdAtk(Skill* curr_skill);
-  int32_t calcValSecdDef(Skill* curr_skill, BattleStats target_stats);
+  int32_t calcValSecdDef(Skill* curr_skill, const BattleStats& target_stats);
   int32_t calcValLuckAtk();
-  int32_t calcValLuckDef(BattleStats target_stats);
+  int32_t calcValLuckDef(const BattleStats& target_stats);
 
   /* Can a given BattleActor be inflicted with the */
   InflictionStatus canInflictTarget(BattleActor* curr_target, Infliction type);
@@ -306,6 +306,11 @@ public:
 
   /* Updates the action index, returns true if one exists */
   bool setNextAction();
+
+  /* Resets the event for a new action, keeping the allocated storage */
+  void reset(ActionType type, BattleActor* actor);
+  void reset(ActionType type, BattleActor* actor,
+             const std::vector<BattleActor*>& targets);
 };
 
 #endif // BATTLE_EVENT_H
@@ -19,6 +19,7 @@ class Ailment;
 class BattleActor;
 class BattleStats;
 
+#include <array>
 #include <vector>
 #include <iostream>
 
@@ -64,13 +65,14 @@ class BattleStats
 {
 public:
   /* Construct the BattleStats with values given by an AttributeSet */
-  BattleStats(AttributeSet max_attr_set, AttributeSet min_attr_set);
+  BattleStats(const AttributeSet& max_attr_set,
+              const AttributeSet& min_attr_set);
 
   BattleStats() = default;
 
 private:
-  /* The base values for the BattleStats */
-  std::vector<std::pair<Attribute, uint32_t>> values;
+  /* The base values for the BattleStats, indexed by enumerated Attribute */
+  std::array<uint32_t, static_cast<uint32_t>(Attribute::MQTD) + 1> values{};
 
   /* All modifiers currently applied to the Attributes */
   std::vector<StatModifier> modifiers;
@@ -98,16 +100,16 @@ public:
   void update(int32_t lifetime_update);
 
   /* Returns the base value stored of a given Attribute */
-  uint32_t getBaseValue(Attribute stat);
+  uint32_t getBaseValue(Attribute stat) const;
 
   /* Returns the value of a given Attribute after modifiers are applied */
-  uint32_t getValue(Attribute stat);
+  uint32_t getValue(Attribute stat) const;
 
   /* Returns a vector of all modifiers for a given Attribute stat */
-  std::vector<StatModifier> getModifiersOfStat(Attribute battle_stat);
+  std::vector<StatModifier> getModifiersOfStat(Attribute battle_stat) const;
 
   /* Returns the number of additive modifiers for a given Attribute */
-  uint32_t getNumAddModifiers(Attribute battle_stat);
+  uint32_t getNumAddModifiers(Attribute battle_stat) const;
 
   /* Assigns a given Attribute stat to a given value */
   bool setBaseValue(Attribute stat, uint32_t value);
@@ -15,6 +15,8 @@
 #ifndef BUFFER_H
 #define BUFFER_H
 
+#include <unordered_map>
+
 #include "Game/Battle/BattleActor.h"
 
 using std::begin;
@@ -33,8 +35,10 @@ enum class BufferSorts
 struct BufferAction
 {
   BufferAction()
-      : cooldown{0},
+      : cooldown_end{0},
         initial_turn{0},
+        momentum{0},
+        sequence{0},
         started{false},
         processed{false},
         user{nullptr},
@@ -45,12 +49,18 @@ struct BufferAction
   {
   }
 
-  /* The number of turns needed after cooldown */
-  uint32_t cooldown;
+  /* The buffer cooldown clock value when the cooldown is done */
+  uint32_t cooldown_end;
 
   /* The turn # the buffer element was added */
   uint32_t initial_turn;
 
+  /* The momentum (LIMB) of the user, taken when the buffer is reordered */
+  uint32_t momentum;
+
+  /* The order the element was added in, to break momentum ties */
+  uint32_t sequence;
+
   /* Has this element started processing */
   bool started;
 
@@ -80,24 +90,47 @@ public:
   Buffer();
 
 private:
+  /* The cooldown clock, advanced once by each updateCooldowns() */
+  uint32_t cooldown_clock;
+
   /* The current index of the buffer */
   uint32_t index;
 
+  /* The sequence number for the next added element */
+  uint32_t next_sequence;
+
   /* Has the buffer been sorted? */
   bool sorted;
 
+  /* The number of skill elements in the buffer for each user */
+  std::unordered_map<BattleActor*, uint16_t> skill_counts;
+
   /* The buffer of actions to take place */
   std::vector<BufferAction> action_buffer;
 
   /*======================== PRIVATE FUNCTIONS ===============================*/
 private:
+  /* Adds an element to the end of the buffer */
+  void add(BufferAction action);
+
   /* Returns a ref. to a BufferAction at a given index */
   BufferAction& getIndex(const uint32_t& index);
 
+  /* Returns the remaining cooldown of an element */
+  uint32_t getRemainingCooldown(const BufferAction& action);
+
   /* Sorts a vector of Buffer actions by a given buffer sort */
   std::vector<BufferAction> sort(std::vector<BufferAction> actions,
                                  BufferSorts buffer_sorts);
 
+  /* Removes an element's skill count, as it is leaving the buffer */
+  void untrack(const BufferAction& action);
+
+  /*===================== PRIVATE STATIC FUNCTIONS ===========================*/
+private:
+  /* Returns the turn order precedence of an action type (lower goes first) */
+  static uint16_t getPrecedence(ActionType type);
+
   /*========================= PUBLIC FUNCTIONS ===============================*/
 public:
   /* Adds a defend element to the buffer */
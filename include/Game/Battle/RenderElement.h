@@ -97,8 +97,9 @@ public:
   Sprite* element_sprite;
   uint32_t loops_to_do;
 
-  /* Textual class members */
+  /* Textual class members. The shadow text is rendered on first use */
   Text element_text;
+  Text shadow_text;
   TTF_Font* element_font;
 
   /* SDL colors to display the element */
@@ -155,6 +156,9 @@ public:
   /* Creates the render element as a turn text */
   void createAsEnterText(std::string text, int32_t sc_height, int32_t sc_width);
 
+  /* Creates the render element as a plep of the animation */
+  void createAsPlep(Sprite* animation, int32_t num_loops, Coordinate point);
+
   /* Creates the render element as a regen value */
   void createAsRegenValue(int32_t amount, DamageType type, int32_t sc_height,
                           int32_t x, int32_t y);
@@ -175,6 +179,9 @@ public:
   /* Creates the render element as a sprite flash */
   void createAsSpriteFlash(SDL_Color color, int32_t flash_time);
 
+  /* Resets the element to a new textual element, for reuse from a pool */
+  void reset(SDL_Renderer* renderer, TTF_Font* element_font);
+
   /* Assigns floatinate acceleration coordinate point */
   void setAcceleration(float acceleration_x, float acceleration_y);
 
@@ -18,12 +18,14 @@ class MapThing;
 
 #include <iostream>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "EnumDb.h"
 #include "Game/EventSet.h"
 #include "Game/KeyHandler.h"
 #include "Helpers.h"
+#include "Logger.h"
 #include "SoundHandler.h"
 #include "XmlData.h"
 
@@ -68,13 +70,14 @@ private:
 
   /*======================== PRIVATE FUNCTIONS ===============================*/
 private:
-  /* Returns the event in the queue: either from the set or event pointer */
-  bool getEvent(Event& event, bool trigger = false);
+  /* Returns the event in the queue: either from the set, event pointer or
+   * queue entry. Referenced in place, not copied */
+  bool getEvent(const Event*& event, bool trigger = false);
   bool getEventPair(EventPair& event_pair, bool trigger = false);
   bool getEventRef(Event*& event_ref, bool trigger = false);
 
   /* Trigger queue sound */
-  void triggerQueueSound(Event event);
+  void triggerQueueSound(const Event& event);
 
   /*========================= PUBLIC FUNCTIONS ===============================*/
 public:
@@ -100,14 +103,14 @@ public:
   /* Returns a reference to the sound handler */
   SoundHandler* getSoundHandler();
 
-  /* Log text */
-  void log(std::string raw);
+  /* Log text, at the debug level */
+  void log(const std::string& raw);
 
-  /* Log/debug an error if debugging is enabled */
-  void logError(std::string raw);
+  /* Log an error */
+  void logError(const std::string& raw);
 
   /* Log warning */
-  void logWarning(std::string raw);
+  void logWarning(const std::string& raw);
 
   /* Check the name of an Item of a Given ID */
   std::string peekItemName(int32_t id);
@@ -276,6 +276,9 @@ private:
   /* Base event set */
   EventSet* base;
 
+  /* Save dirty flag - set when the saved state changes after a save */
+  bool dirty;
+
   /* Event sets */
   Event event_locked;
   std::vector<Event> events_unlocked;
@@ -342,6 +345,9 @@ public:
   /* Returns if there is data to save */
   bool isDataToSave();
 
+  /* Returns if the saved state has changed since the flag was cleared */
+  bool isDirty();
+
   /* Returns if the class is empty (default state after a clear() call) */
   bool isEmpty();
 
@@ -360,6 +366,9 @@ public:
   /* Sets the base set reference */
   void setBase(EventSet* new_base);
 
+  /* Sets or clears the save dirty flag */
+  void setDirty(bool dirty = true);
+
   /* Individual setters for events */
   bool setEventLocked(Event new_event);
   bool setEventUnlocked(int index, Event new_event, bool replace = false);
@@ -513,34 +522,39 @@ public:
   static void dataEnumView(UnlockView view_enum, bool& view, bool& scroll);
 
   /* Extract data from event(s) */
-  static bool dataEventGiveItem(Event event, int& item_id, int& count,
+  static bool dataEventGiveItem(const Event& event, int& item_id, int& count,
                                 GiveItemFlags& flags, int& chance);
-  static bool dataEventMultiple(Event event, std::vector<Event>& event_list);
+  static bool dataEventMultiple(const Event& event,
+                                std::vector<Event>& event_list);
   static bool dataEventMultiple(Event* event,
                                 std::vector<Event*>& event_list);
-  static bool dataEventNotification(Event event, std::string& notification);
-  static bool dataEventPropMod(Event event, ThingBase& type, int& id,
+  static bool dataEventNotification(const Event& event,
+                                    std::string& notification);
+  static bool dataEventPropMod(const Event& event, ThingBase& type, int& id,
                                ThingProperty& props, ThingProperty& bools,
                                int& respawn, int& speed, TrackingState& track,
                                int& inactive);
   static bool dataEventStartBattle(Event* event, BattleFlags& flags,
                                    Event*& event_win, Event*& event_lose);
-  static bool dataEventStartMap(Event event, int& map_id);
-  static bool dataEventTakeItem(Event event, int& item_id, int& count);
-  static bool dataEventTeleport(Event event, int& thing_id, int& x, int& y,
-                                int& section_id);
-  static bool dataEventTriggerIO(Event event, int& io_id);
-  static bool dataEventUnlockIO(Event event, int& io_id, UnlockIOMode& mode,
-                                int& state_num, UnlockIOEvent& mode_events,
+  static bool dataEventStartMap(const Event& event, int& map_id);
+  static bool dataEventTakeItem(const Event& event, int& item_id, int& count);
+  static bool dataEventTeleport(const Event& event, int& thing_id, int& x,
+                                int& y, int& section_id);
+  static bool dataEventTriggerIO(const Event& event, int& io_id);
+  static bool dataEventUnlockIO(const Event& event, int& io_id,
+                                UnlockIOMode& mode, int& state_num,
+                                UnlockIOEvent& mode_events,
                                 UnlockView& mode_view, int& view_time);
-  static bool dataEventUnlockThing(Event event, int& thing_id,
+  static bool dataEventUnlockThing(const Event& event, int& thing_id,
                                    UnlockView& mode_view, int& view_time);
-  static bool dataEventUnlockTile(Event event, int& section_id, int& tile_x,
-                                  int& tile_y, UnlockTileMode& mode,
-                                  UnlockView& mode_view, int& view_time);
+  static bool dataEventUnlockTile(const Event& event, int& section_id,
+                                  int& tile_x, int& tile_y,
+                                  UnlockTileMode& mode, UnlockView& mode_view,
+                                  int& view_time);
 
   /* Extract data from lock(s) */
-  static bool dataLockedItem(Locked lock, int& id, int& count, bool& consume);
+  static bool dataLockedItem(const Locked& lock, int& id, int& count,
+                             bool& consume);
 
   /* Deletes the given conversation in entirety - recursive */
   static void deleteConversation(Conversation* convo, bool first = true);
@@ -12,7 +12,10 @@
 #define GAME_H
 
 #include <SDL2/SDL.h>
+#include <SDL2/SDL_image.h>
 #include <chrono>
+#include <future>
+#include <map>
 #include <memory>
 
 // #include "Game/Battle/AIModuleTester.h"
@@ -117,15 +120,31 @@ private:
   FileHandler save_handle;
   uint8_t save_slot;
 
+  /* The save write running on a worker thread, if any */
+  std::future<bool> save_job;
+
+  /* Snapshot capture. The map is rendered into the frame target and scaled
+   * down into the shot target on the GPU, then read back a frame later and
+   * encoded on a worker thread */
+  SDL_Texture* shot_frame;
+  std::future<bool> shot_job;
+  std::string shot_path;
+  bool shot_rendered;
+  bool shot_requested;
+  SDL_Texture* shot_target;
+
   /* Number of ticks since inception */
   uint64_t ticks_total;
 
   /* ------------ Constants --------------- */
 public:
   static const std::string kSAVE_IMG_BACK; /* Back of save img path */
+  static const std::string kSAVE_IMG_LEGACY; /* Back of older save imgs */
+  static const uint8_t kSAVE_IMG_SCALE; /* Save img downscale factor */
   static const std::string kSAVE_PATH_AUTO; /* The auto path addition */
   static const std::string kSAVE_PATH_BACK; /* Back of save path */
   static const std::string kSAVE_PATH_FRONT; /* Front of save path */
+  static const std::string kSAVE_PATH_MAP; /* The map section path addition */
   static const uint8_t kSAVE_SLOT_DEFAULT; /* The default save slot */
   static const uint8_t kSAVE_SLOT_MAX; /* Max number of save slots */
 
@@ -207,6 +226,9 @@ private:
   /* Returns the core struct item data for correlation purposes */
   std::vector<ItemData> getItemData();
 
+  /* Returns the map levels with section files in the slot, and their count */
+  std::map<int, uint16_t> getSlotMaps(uint8_t slot, bool encryption = false);
+
   /* Load game */
   bool load(std::string base_file, SDL_Renderer* renderer,
             uint8_t slot = 0, bool encryption = false,
@@ -229,6 +251,9 @@ private:
    * in the game */
   void pollEvents();
 
+  /* Reads back the captured snapshot and hands it to the worker to write */
+  void readScreenshot(SDL_Renderer* renderer);
+
   /* Remove functions for game objects */
   void removeActions();
   void removeAll(); /* Properly staged remove all call */
@@ -244,12 +269,22 @@ private:
   void removeSkills();
   void removeSkillSets();
 
+  /* Renders the map, capturing the snapshot from it if one is requested */
+  bool renderMap(SDL_Renderer* renderer);
+
+  /* Requests a snapshot of the map to be written to the path */
+  void requestScreenshot(std::string path);
+
   /* Update mode */
   void updateMode(int cycle_time);
   void updateMenuEnabledState();
   void updateMenuSaving();
   void updatePlayerSteps();
 
+  /* Finishes the save running on the worker thread, once it is complete or
+   * right away if wait is set */
+  void updateSaving(bool wait = false);
+
 /*========================= PUBLIC FUNCTIONS ===============================*/
 public:
   /* Enable view trigger */
@@ -344,13 +379,16 @@ public:
 
 /*===================== PUBLIC STATIC FUNCTIONS ===========================*/
 public:
+  /* Returns the save string of a map section file in the slot */
+  static std::string getSlotMapPath(uint8_t slot, std::string base_path,
+                                    int level, uint16_t section);
+
   /* Returns the save string based on the slot number */
   static std::string getSlotPath(uint8_t slot, std::string base_path = "",
                                  bool image = false, bool precall = false);
 
-  /* Saves screenshot of the current game as it stands */
-  static bool saveScreenshot(std::string path, SDL_Rect rect,
-                             SDL_Renderer* renderer, uint8_t factor = 4);
+  /* Writes a captured screenshot as a PNG. Frees it */
+  static bool writeScreenshot(std::string path, SDL_Surface* shot);
 };
 
 #endif // GAME_H
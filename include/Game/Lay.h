@@ -62,8 +62,8 @@ private:
   /* Pointer to the Lay Tile's sprite */
   Sprite* lay_sprite;
 
-  /* The vector of lay tiles */
-  std::vector<Coordinate> lay_tiles;
+  /* The wrapped offset of the lay image on screen, within the screen size */
+  Coordinate offset;
 
   /* Base sprite bath */
   std::string path;
@@ -88,21 +88,22 @@ public:
 
   /*======================== PRIVATE FUNCTIONS ===============================*/
 private:
-  /* Create a lay at a given index */
-  void createTiledLay(LayIndex lay_index);
-
   /* Asserts the assigned range is valid */
   bool isRangeValid();
 
-  /* Update the tiled lays by a distance x, y */
-  void updateLocations(int32_t dist_x, int32_t dist_y);
+  /* Renders the part of the lay image at the screen offset into dest */
+  bool renderPart(SDL_Renderer* renderer, SDL_Rect dest, int32_t src_x,
+                  int32_t src_y);
+
+  /* Update the wrapped offset of the lay by a distance x, y */
+  void updateOffset(int32_t dist_x, int32_t dist_y);
 
   /*========================= PUBLIC FUNCTIONS ===============================*/
 public:
   /* Create the lay over data from the lay over struct */
   void createFromLayStruct(LayOver lay_data, SDL_Renderer* renderer = nullptr);
 
-  /* Create the starting tiled lays based on the velocity */
+  /* Create the lay sprite and reset the wrapped offset */
   bool createTiledLays(SDL_Renderer* renderer);
 
   /* Evaluates and returns the state of a given LayState flag */
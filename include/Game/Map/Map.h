@@ -10,6 +10,9 @@
 #ifndef MAP_H
 #define MAP_H
 
+#include <list>
+#include <map>
+#include <unordered_map>
 #include <vector>
 
 #include "FileHandler.h"
@@ -26,6 +29,7 @@
 #include "Game/Map/MapViewport.h"
 // #include "Game/Map/Sector.h"
 #include "Game/Map/Tile.h"
+#include "Game/Map/TimerWheel.h"
 #include "Game/Lay.h"
 // #include "Helpers.h"
 // #include "Options.h"
@@ -37,6 +41,9 @@ struct SubMap
   /* Tile data */
   std::vector<std::vector<Tile*>> tiles;
 
+  /* Tile events, stored only for the tiles (x, y) that have them */
+  std::map<std::pair<uint32_t, uint32_t>, TileEvents> tile_events;
+
   /* Thing data (and children) */
   std::vector<MapInteractiveObject*> ios;
   std::vector<MapItem*> items;
@@ -51,6 +58,37 @@ struct SubMap
   std::vector<uint32_t> battles;
   std::vector<uint32_t> music;
   int32_t weather;
+
+  /* Save status - if the section has changed since it was last saved */
+  bool dirty;
+};
+
+/* Render list entry - the things stored on a tile at a given render depth */
+struct MapRenderEntry
+{
+  /* The tile the things are rendered on */
+  Tile* tile;
+
+  /* The things to render (null if not set at the depth) */
+  MapInteractiveObject* io;
+  MapPerson* person;
+  MapThing* thing;
+};
+
+/* Low detail chunk - a square of tiles with the lower and upper layers baked
+ * at a reduced tile size, rendered in place of the tiles when zoomed out */
+struct MapLodChunk
+{
+  /* Has the chunk been baked */
+  bool baked;
+
+  /* The baked layers (upper is null if no tile in the chunk has one) */
+  SDL_Texture* lower;
+  SDL_Texture* upper;
+
+  /* The view stamp last used in and the place in the recently used list */
+  uint32_t stamp;
+  std::list<uint32_t>::iterator used;
 };
 
 /* Class for map control */
@@ -74,6 +112,9 @@ public:
   };
 
 private:
+  /* The animation clock (ms) that drives all tile sprite frames */
+  uint32_t animation_clock;
+
   /* Base things */
   std::vector<MapInteractiveObject*> base_ios;
   std::vector<MapItem*> base_items;
@@ -125,6 +166,18 @@ private:
   /* Indication if the map has been loaded */
   bool loaded;
 
+  /* Low detail chunks of the section they were baked for, when zoomed out.
+   * The baked ones are kept in a recently used list (most recent first)
+   * with the chunk region and stamp of the view */
+  std::vector<MapLodChunk> lod_chunks;
+  std::list<uint32_t> lod_lru;
+  SDL_Rect lod_region;
+  uint16_t lod_section;
+  uint32_t lod_stamp;
+
+  /* The scratch target each tile is painted to before it is baked down */
+  SDL_Texture* lod_scratch;
+
   /* The menus and dialogs on top of the map */
   MapDialog map_dialog;
 
@@ -145,8 +198,11 @@ private:
   Text name_text;
   uint16_t name_view;
 
-  /* Active player reference - controlled by keyboard (or gamepad) */
+  /* Active player reference - controlled by keyboard (or gamepad) and the
+   * tile it was on when idle npcs were last checked for tracking range */
   MapPerson* player;
+  uint16_t player_x;
+  uint16_t player_y;
 
   // /* The sectors on the map (for rooms, caves, houses etc) */
   // QList<Sector> sectors;
@@ -154,13 +210,31 @@ private:
   /* Speed factor - for map based elements */
   float speed_factor;
 
+  /* Per frame render list, bucketed by render depth. Only cleared between
+   * frames so the storage is reused */
+  std::vector<std::vector<MapRenderEntry>> render_list;
+
+  /* Tile sprite streaming - the recently used sprites (most recent first,
+   * with the region stamp last used in), the load queue and the region */
+  std::list<std::pair<Sprite*, uint32_t>> stream_lru;
+  std::unordered_map<Sprite*, std::list<std::pair<Sprite*, uint32_t>>::iterator>
+      stream_lookup;
+  std::vector<Sprite*> stream_queue;
+  SDL_Rect stream_region;
+  uint16_t stream_section;
+  uint32_t stream_stamp;
+
   /* The set of map data */
   std::vector<SubMap> sub_map;
 
   /* The system options, used for rendering, settings, etc. */
   Options* system_options;
 
-  /* The number of pixels for each tile in the class */
+  /* Wake up timers for idle (sleeping) things and the fired stack */
+  TimerWheel thing_timers;
+  std::vector<TimerEntry> thing_timers_fired;
+
+  /* The number of pixels for each tile in the class (unzoomed) */
   uint16_t tile_height;
   uint16_t tile_width;
 
@@ -186,8 +260,10 @@ private:
   // * a later time) */
   // Weather* weather_effect;
 
-  /* Status of the zoom on the map */
+  /* Status of the zoom on the map. The zoom is a render scale of the current
+   * tile size over the tile size, which moves towards the zoom size */
   bool zooming;
+  float zoom_curr;
   uint16_t zoom_size;
 
   /*------------------- Constants -----------------------*/
@@ -201,6 +277,11 @@ private:
   const static uint8_t kFILE_SECTION_ID; /* The section identifier, for file */
   const static uint8_t kFILE_TILE_COLUMN; /* The tile depth in XML of column */
   const static uint8_t kFILE_TILE_ROW; /* The tile depth in XML of row */
+  const static uint8_t kLOD_BAKES; /* Low detail chunks baked per frame */
+  const static uint8_t kLOD_CHUNK; /* Tiles on each side of a chunk */
+  const static uint16_t kLOD_CHUNKS; /* Baked chunks kept resident */
+  const static uint8_t kLOD_MARGIN; /* Chunks kept around the viewport */
+  const static uint16_t kLOD_TILE_SIZE; /* Tile size baked in and used below */
   const static uint8_t kMAX_U8BIT; /* Max unsigned 8 bit */
   const static uint32_t kMUSIC_REPEAT; /* Milliseconds each song repeats */
   const static uint16_t kNAME_DISPLAY; /* Time to display map name */
@@ -209,6 +290,10 @@ private:
   const static float kNAME_X; /* The top left x location of text */
   const static float kNAME_Y; /* The top left y location of text */
   const static uint8_t kPLAYER_ID; /* The player ID for computer control */
+  const static uint8_t kSTREAM_LOADS; /* Streamed sprites built per frame */
+  const static uint8_t kSTREAM_MARGIN; /* Tiles streamed around viewport */
+  const static uint16_t kSTREAM_SPRITES; /* Streamed sprites kept resident */
+  const static float kZOOM_RATE; /* Zoom rate, in tile pixels per ms */
   const static uint16_t kZOOM_TILE_SIZE; /* The tile size, when zoomed out */
 
 public:
@@ -236,9 +321,16 @@ private:
   void audioStop();
   void audioUpdate(bool sub_change = false);
 
+  /* Bakes the low detail chunk at the index of the current section */
+  bool bakeLodChunk(SDL_Renderer* renderer, uint32_t index);
+
   /* Change the mode that the game is running */
   bool changeMode(MapMode mode);
 
+  /* Releases the baked low detail chunks */
+  void clearLod();
+  void clearLodChunk(uint32_t index);
+
   /* Returns the color mode from the active set of data */
   ColorMode getColorMode();
 
@@ -291,6 +383,12 @@ private:
   /* Returns if the color is currently in a transition status */
   bool isColorTransitioning();
 
+  /* Returns if the map renders from the low detail chunks */
+  bool isLodActive();
+
+  /* Returns if the sub map has changed since it was last saved */
+  bool isSectionDirty(uint16_t section);
+
   /* Mode view updates */
   bool modeViewStart(int cycle_time, bool travel);
   bool modeViewStop(int cycle_time, bool travel);
@@ -306,6 +404,15 @@ private:
                            uint16_t* r_start, uint16_t* r_end,
                            uint16_t* c_start, uint16_t* c_end);
 
+  /* Renders the things of a single render list entry at the given depth */
+  void renderEntry(SDL_Renderer* renderer, const MapRenderEntry& entry,
+                   uint8_t index, int x_offset, int y_offset);
+
+  /* Renders the lower or upper tiles in the viewport, from the low detail
+   * chunks where baked and tile by tile otherwise */
+  bool renderLod(SDL_Renderer* renderer, bool upper, int x_offset,
+                 int y_offset);
+
   /* Save the passed in sub map based on the map ID and other information */
   bool saveSubMap(FileHandler* fh, const uint32_t &id = 0,
                   const std::string &wrapper = "section",
@@ -325,10 +432,16 @@ private:
   /* Sets the starting (and next) tiles of a newly generated thing */
   bool setTiles(MapThing* ref);
 
+  /* Puts the thing to sleep, if it is idle after its update */
+  void sleepThing(MapThing* thing, bool active_map);
+
   /* Splits the ID into a vector of IDs */
   std::vector<std::vector<int32_t>> splitIdString(std::string id,
                                                   bool matrix = false);
 
+  /* Marks the sprite as used in the current stream region */
+  void streamSprite(Sprite* sprite);
+
   /* Lay triggers based on passed in information */
   bool triggerLay(std::string path,
                   int anim_time = Sprite::kDEFAULT_ANIMATE_TIME,
@@ -351,11 +464,24 @@ private:
   bool updateFade(int cycle_time);
   void updateMode(int cycle_time);
 
+  /* Sets up the low detail chunks of the section and bakes a few in view */
+  bool updateLod(SDL_Renderer* renderer);
+
   /* Update the Running state of the Player */
   void updatePlayerRunState(KeyHandler& key_handler);
 
-  /* Updates the height and width, based on zoom factors */
-  void updateTileSize(bool force = false);
+  /* Streams tile sprites in around the viewport and evicts unused ones */
+  void updateStream(SDL_Renderer* renderer);
+
+  /* Updates the viewport size to cover the screen at the current zoom */
+  void updateViewportSize();
+
+  /* Updates the current zoom towards the zoom size */
+  void updateZoom(int cycle_time = 0, bool force = false);
+
+  /* Wakes sleeping things, either one, one section or all (section < 0) */
+  void wakeThing(MapThing* thing);
+  void wakeThings(int section = -1);
 
   /* Zoom trigger */
   void zoom(uint16_t tile_size = kZOOM_TILE_SIZE, bool force = false);
@@ -406,6 +532,12 @@ public:
   /* Returns the number of steps the player has used on map */
   uint32_t getPlayerSteps();
 
+  /* Returns the sections that changed since the last save, or all if full */
+  std::vector<uint16_t> getSaveSections(bool full = false);
+
+  /* Returns the number of sections in the map */
+  uint16_t getSectionCount();
+
   /* Returns the rect (in pixels) snapshot of the map viewport */
   SDL_Rect getSnapshotRect();
 
@@ -468,8 +600,8 @@ public:
   /* Resets the player steps */
   void resetPlayerSteps();
 
-  /* Saves the current map data to the active file handling pointer location */
-  bool saveData(FileHandler* fh);
+  /* Saves the map section under the map element in the file */
+  bool saveData(FileHandler* fh, XmlData data_map, uint16_t section);
 
   /* Seta and correlates the base items within the map to the core data */
   bool setBaseItems(std::vector<ItemData> items, SDL_Renderer* renderer);
@@ -9,6 +9,7 @@
 #define MAPDIALOG_H
 
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "EnumDb.h"
@@ -33,6 +34,14 @@ struct Notification
   SDL_Color text_color;
 };
 
+/* Laid out text of a conversation step, measured and wrapped once */
+struct DialogLayout
+{
+  vector<vector<vector<pair<string, TextProperty>>>> lines;
+  vector<vector<vector<pair<string, TextProperty>>>> options;
+  vector<vector<int>> widths; /* Reveal widths of each line */
+};
+
 class MapDialog
 {
 public:
@@ -95,6 +104,10 @@ private:
   /* Item data */
   std::vector<ItemData> item_data;
 
+  /* Conversation layouts, keyed by line width, text and options */
+  std::unordered_map<string, DialogLayout> layout_cache;
+  uint16_t layout_prefetch;
+
   /* The queue that holds all bottom notifications that need to be displayed */
   vector<Notification> notification_queue;
   uint16_t notification_time;
@@ -127,6 +140,8 @@ private:
   uint16_t text_offset_max;
   vector<Text*> text_options;
   vector<vector<vector<pair<string, TextProperty>>>> text_strings;
+  vector<int> text_clip;
+  vector<vector<int>> text_widths;
 
   /* Text control */
   uint16_t text_top;
@@ -146,6 +161,7 @@ private:
   const static uint16_t kHOLD_DELAY; /* The delay between frame sequencing */
   const static uint8_t kHOLD_OFFSET; /* Offset from bottom of screen to mid */
   const static std::string kITEM_COLOR; /* Hex color of item reference */
+  const static uint16_t kLAYOUT_CACHE_MAX; /* Max cached conversation layouts */
   const static uint8_t kLINE_SPACING; /* The spacing between lines of font */
   const static uint8_t kMARGIN_SIDES; /* The left and right margin size */
   const static uint8_t kMARGIN_TOP; /* The top margin size */
@@ -186,6 +202,9 @@ private:
   /* Executes an event, triggered from a conversation */
   void executeEvent();
 
+  /* Returns the text line width for a conversation step of the given thing */
+  int getConversationWidth(MapThing* thing);
+
   /* Get name if reference item */
   std::string getItemName(int id);
   std::string getItemName(std::string id);
@@ -194,6 +213,12 @@ private:
   string getThingName(int id, vector<MapThing*>* things = nullptr);
   MapThing* getThingReference(int id, vector<MapThing*>* things = nullptr);
 
+  /* Returns the layout of a conversation step, laying it out if not cached */
+  DialogLayout* getLayout(Conversation* convo, int line_width);
+
+  /* Lays out one of the steps that can follow the current conversation */
+  void prefetchLayout();
+
   /* Render the options. Deletes previous options, if they exist */
   void renderOptions(
       SDL_Renderer* renderer,
@@ -76,6 +76,9 @@ private:
   /* Only to be called by the handler */
   void handlerInteract();
 
+  /* Returns if the inactive time is counting down to a return */
+  bool isReturnPending();
+
   /* Sets the current sequence of the node to the parent frames and resets the
    * pointers, where applicable */
   void setParentFrames();
@@ -146,6 +149,9 @@ public:
   /* Returns the locked state struct */
   Locked getLock();
 
+  /* Returns the time the IO can sleep - reimplemented */
+  int getSleepTime(bool active_map);
+
   /* Returns the state, corresponding to the parameters listed */
   StateNode* getStateCurrent();
   StateNode* getStateHead();
@@ -156,6 +162,9 @@ public:
   /* Interact with the thing (use key) */
   bool interact(MapPerson* initiator);
 
+  /* Returns if the saved state has changed since it was last saved */
+  virtual bool isDirty();
+
   /* Returns if the instance (or base) time is valid */
   bool isInactiveTimeValid();
 
@@ -174,6 +183,9 @@ public:
   /* Sets the color mode of all sprites within the thing */
   void setColorMode(ColorMode mode);
 
+  /* Sets or clears the save dirty flag, including the state events */
+  virtual void setDirty(bool dirty = true);
+
   /* Sets the inactive time before returning down the state path (ms) */
   void setInactiveTime(int time);
 
@@ -199,6 +211,9 @@ public:
 
   /* Unsets all states - this handles deletion */
   void unsetFrames(bool delete_frames = true);
+
+  /* Wakes the IO, crediting the ms lapsed to the inactive time */
+  void wake(int lapsed = 0);
 };
 
 #endif // MAPINTERACTIVEOBJECT_H
@@ -133,6 +133,7 @@ private:
 
   /* Tracking functions - called by update */
   void trackAvoidPlayer(int cycle_time, bool stopped);
+  int trackDelta();
   int trackOutOfRange(MapPerson* ref = nullptr);
 
   /* update the node bounding rect */
@@ -186,6 +187,9 @@ public:
   /* Returns the predicted move request in the class */
   Direction getPredictedMoveRequest();
 
+  /* Returns the time the NPC can sleep - reimplemented */
+  int getSleepTime(bool active_map);
+
   /* Returns the spotted information */
   Frame* getSpottedImage();
   int getSpottedTime();
@@ -205,9 +209,15 @@ public:
   /* Starts interaction - on a forced trigger */
   bool interactForced(MapPerson* initiator);
 
+  /* Returns if the saved state has changed since it was last saved */
+  virtual bool isDirty();
+
   /* Returns if the NPC will force interaction */
   bool isForcedInteraction(bool false_if_active = true);
 
+  /* Returns if the player is close enough to trigger tracking */
+  bool isPlayerInTrackRange();
+
   /* Returns if there is any form of tracking */
   bool isTracking();
 
@@ -254,6 +264,9 @@ public:
   Floatinate update(int cycle_time, std::vector<std::vector<Tile*>> tile_set,
                     bool active_map = false);
 
+  /* Wakes the NPC, crediting the ms lapsed to the node delay */
+  void wake(int lapsed = 0);
+
 /*=============================================================================
  * PUBLIC STATIC FUNCTIONS
  *============================================================================*/
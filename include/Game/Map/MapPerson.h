@@ -173,6 +173,9 @@ public:
   /* Returns the stored player. Blank in Person, used in NPC child */
   virtual MapPerson* getPlayer();
 
+  /* Returns the time the person can sleep - reimplemented */
+  virtual int getSleepTime(bool active_map);
+
   /* Returns the starting facing direction of the person */
   Direction getStartingDirection() const;
 
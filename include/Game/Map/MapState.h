@@ -86,6 +86,9 @@ public:
   /* Is data available to save */
   bool isDataToSave();
 
+  /* Returns if any event has changed since the dirty flags were cleared */
+  bool isDirty();
+
   /* Check if events or interactions are set */
   bool isEnterEventSet();
   bool isExitEventSet();
@@ -99,6 +102,9 @@ public:
   /* Sets the base state reference */
   void setBase(MapState* new_base);
 
+  /* Sets or clears the save dirty flag of all events */
+  void setDirty(bool dirty = true);
+
   /* Sets the event handler - this call clears out all existing events */
   void setEventHandler(EventHandler* event_handler);
 
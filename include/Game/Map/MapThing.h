@@ -61,6 +61,9 @@ protected:
   /* The thing changed flag - based on property event changeable items */
   bool changed;
 
+  /* The save dirty flag - set when the saved state changes after a save */
+  bool dirty;
+
   /* The thing classification */
   std::string description;
   int id;
@@ -73,6 +76,11 @@ protected:
   /* Painting information */
   Frame dialog_image;
 
+  /* Idle status - if sleeping, the map skips the update call */
+  bool sleeping;
+  bool sleep_active;
+  uint32_t sleep_clock;
+
   /* The event handler information and corresponding interact event */
   EventHandler* event_handler;
   EventSet event_set;
@@ -119,6 +127,11 @@ protected:
   const static uint8_t kRAW_MULTIPLIER; /* The coordinate raw multiplier */
   const static int kUNSET_ID; /* The placeholder unset ID */
 
+public:
+  /* ----------------------- Public Constants --------------------- */
+  const static int kSLEEP_NONE; /* Sleep time if the thing needs updates */
+  const static int kSLEEP_UNTIMED; /* Sleep time if idle until touched */
+
 /*======================= PROTECTED FUNCTIONS ==============================*/
 protected:
   /* Animates the thing, if it has multiple frames */
@@ -141,6 +154,9 @@ protected:
   Tile* getTileMain(uint32_t x, uint32_t y);
   Tile* getTilePrevious(uint32_t x, uint32_t y);
 
+  /* Returns if the current frames change as time passes */
+  bool isAnimated();
+
   /* Is data available to save */
   virtual bool isDataToSave();
 
@@ -290,6 +306,10 @@ public:
   bool getPassabilityEntering(Tile* frame_tile, Direction dir);
   bool getPassabilityExiting(Tile* frame_tile, Direction dir);
 
+  /* Returns the map clock when sleep started and the time it can sleep for */
+  uint32_t getSleepClock() const;
+  virtual int getSleepTime(bool active_map);
+
   /* Returns the sound ID reference */
   int32_t getSoundID() const;
 
@@ -334,6 +354,9 @@ public:
   /* Is the thing almost centered on a tile (less than 1 pulse away) */
   bool isAlmostOnTile(int cycle_time);
 
+  /* Returns if the saved state has changed since it was last saved */
+  virtual bool isDirty();
+
   /* Returns if there is a move request for the given thing */
   virtual bool isMoveRequested();
 
@@ -346,6 +369,9 @@ public:
   /* Is the thing centered on a tile */
   bool isOnTile();
 
+  /* Returns if the thing is idle and skipped by the map update */
+  bool isSleeping() const;
+
   /* Is the rendering tiles set, for the frames */
   bool isTilesSet();
 
@@ -384,6 +410,9 @@ public:
   /* Sets the dialog image data, for display during conversation */
   bool setDialogImage(std::string path, SDL_Renderer* renderer);
 
+  /* Sets or clears the save dirty flag (clearing also clears the events) */
+  virtual void setDirty(bool dirty = true);
+
   /* Sets the event handler */
   void setEventHandler(EventHandler* event_handler);
 
@@ -436,6 +465,9 @@ public:
   /* Sets the visibility of the rendering thing */
   void setVisibility(bool visible);
 
+  /* Puts the thing to sleep at the given map clock */
+  void sleep(uint32_t clock, bool active_map = false);
+
   /* Triggers walk on / walk off events on the thing */
   virtual void triggerWalkOff(MapPerson* trigger);
   virtual void triggerWalkOn(MapPerson* trigger);
@@ -451,6 +483,9 @@ public:
 
   /* Unset the rendering tiles in the class */
   virtual void unsetTiles(bool no_events = false);
+
+  /* Wakes the thing, crediting the ms lapsed while it slept */
+  virtual void wake(int lapsed = 0);
 };
 
 #endif // MAPTHING_H
@@ -26,6 +26,14 @@ class MapThing;
 #include "Helpers.h"
 #include "Sprite.h"
 
+/* Tile event storage - the enter and exit events of a single tile. Held
+ * sparsely by the map for only the tiles that have events set */
+struct TileEvents
+{
+  EventSet enter;
+  EventSet exit;
+};
+
 class Tile
 {
 public:
@@ -57,9 +65,9 @@ private:
   /* The enhancer information */
   Sprite* enhancer;
 
-  /* Events for entering and exiting the tile and the handler */
-  EventSet event_enter;
-  EventSet event_exit;
+  /* Events for entering and exiting the tile (null if none) and the
+   * handler */
+  TileEvents* events;
   EventHandler* event_handler;
 
   /* The lower information */
@@ -114,7 +122,7 @@ public:
   /* Gets the enhancer layer */
   Sprite* getEnhancer() const;
 
-  /* Returns event pointers */
+  /* Returns event pointers. Null if the tile has no events */
   EventSet* getEventEnter();
   EventSet* getEventExit();
 
@@ -127,7 +135,7 @@ public:
 
   /* Returns the map thing pointer for the item object */
   uint16_t getItemCount() const;
-  std::vector<MapItem*> getItems() const;
+  const std::vector<MapItem*>& getItems() const;
 
   /* Gets the lower layer(s) */
   std::vector<Sprite*> getLower() const;
@@ -230,6 +238,9 @@ public:
   /* Sets the event handler - this call also clears out all existing events */
   void setEventHandler(EventHandler* event_handler);
 
+  /* Sets the event storage reference, owned by the map */
+  void setEvents(TileEvents* events);
+
   /* Sets the new height for the tile (must be >= 0) */
   void setHeight(uint16_t height);
 
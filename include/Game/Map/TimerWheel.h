@@ -0,0 +1,79 @@
+/******************************************************************************
+ * Class Name: TimerWheel
+ * Date Created: October 19, 2026
+ * Inheritance: none
+ * Description: A hierarchical timer wheel for scheduling the wake up of idle
+ *              map things. Each level holds a ring of slots, with each slot
+ *              on a level spanning the full ring of the level below. Entries
+ *              cascade down a level as their deadline approaches, so adding
+ *              and firing a timer is constant time regardless of how many
+ *              things are waiting.
+ *****************************************************************************/
+#ifndef TIMERWHEEL_H
+#define TIMERWHEEL_H
+
+class MapThing;
+
+#include <cstdint>
+#include <vector>
+
+/* A single scheduled wake up */
+struct TimerEntry
+{
+  /* The thing to wake */
+  MapThing* thing;
+
+  /* The wheel clock (ms) when the thing was put to sleep */
+  uint32_t sleep_clock;
+
+  /* The absolute tick the entry expires on */
+  uint64_t expiry;
+};
+
+class TimerWheel
+{
+public:
+  /* Constructor function */
+  TimerWheel();
+
+private:
+  /* The running clock, in milliseconds */
+  uint32_t clock;
+
+  /* The number of whole ticks processed and the left over ms */
+  uint64_t tick;
+  uint32_t tick_remainder;
+
+  /* The slots of the wheel, for every level (flattened levels x slots) */
+  std::vector<std::vector<TimerEntry>> slots;
+
+  /* -------------------------- Constants ------------------------- */
+  const static uint8_t kLEVELS; /* The number of levels in the wheel */
+  const static uint8_t kSLOT_BITS; /* The bits of the tick per level */
+  const static uint16_t kSLOTS; /* The number of slots on each level */
+  const static uint32_t kTICK_MS; /* The resolution of a tick, in ms */
+
+/*======================== PRIVATE FUNCTIONS ===============================*/
+private:
+  /* Cascades the slot on the given level down to the lower levels */
+  void cascade(uint8_t level);
+
+  /* Places an entry in the slot that corresponds to its expiry */
+  void place(const TimerEntry& entry);
+
+/*========================= PUBLIC FUNCTIONS ===============================*/
+public:
+  /* Adds a wake up for the thing, delay ms from the current clock */
+  void add(MapThing* thing, uint32_t delay);
+
+  /* Clears all pending wake ups and resets the clock */
+  void clear();
+
+  /* Returns the running clock, in milliseconds */
+  uint32_t getClock() const;
+
+  /* Advances the clock and appends all the fired entries */
+  void update(int cycle_time, std::vector<TimerEntry>& fired);
+};
+
+#endif // TIMERWHEEL_H
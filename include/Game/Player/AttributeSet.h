@@ -8,7 +8,9 @@
  *
  * Notes
  * -----
- * [1]:
+ * [1]: Values are held in a fixed-size array sized by the Attribute enum, so
+ *      sets can be copied and combined without any heap allocation. The
+ *      string name lookups are only intended for use while loading data.
  *
  * TODO
  * ----
@@ -17,6 +19,8 @@
 #ifndef ATTRIBUTESET_H
 #define ATTRIBUTESET_H
 
+#include <array>
+#include <cmath>
 #include <iostream>
 #include <vector>
 
@@ -35,6 +39,14 @@ enum class AttributeState
 class AttributeSet
 {
 public:
+  /* Number of stats in a set, sized by the enumerated Attribute values */
+  static constexpr uint32_t kNUM_ELEMENTS{static_cast<uint32_t>(Attribute::WILL)
+                                          + 1};
+
+  /* Fixed, stack-allocated block of stat values (or per-stat factors) */
+  using StatBlock = std::array<int32_t, kNUM_ELEMENTS>;
+  using FactorBlock = std::array<float, kNUM_ELEMENTS>;
+
   /* Default constructor */
   AttributeSet();
 
@@ -60,7 +72,7 @@ private:
   AttributeState flags{static_cast<AttributeState>(0)};
 
   /* The values of the statistics within the AttributeSet */
-  std::vector<int32_t> values{};
+  StatBlock values{};
 
   /* ------------ Constants --------------- */
   static const std::vector<std::string> kSHORT_NAMES; /* The names of Attrs  */
@@ -73,21 +85,29 @@ public:
   static const int32_t kMIN_P_VALUE;   /* The minimum value for a p. set */
   static const int32_t kMIN_VALUE;     /* The minimum value of any stat  */
   static const uint32_t kMAX_VALUE;    /* The maximum value of any stat  */
-  static const uint32_t kNUM_ELEMENTS; /* Number of elements in set */
 
   /*======================== PRIVATE FUNCTIONS ===============================*/
 private:
   /* Basic setup for construction */
   void classSetup(const bool& personal, const bool& constant);
 
+  /* Returns the lower bound of a stat, based on the personal flag */
+  int32_t getMinValue() const;
+
   /*========================= PUBLIC FUNCTIONS ===============================*/
 public:
   /* Method for storing and building AttributeSets from preset values */
   void buildAsPreset(const size_t& level = 0);
 
-  /* Assert all values are within range--including size of values */
+  /* Element-wise clamp of all values within the given range */
+  void clamp(const int32_t& min_value, const int32_t& max_value);
+
+  /* Assert all values are within range */
   void cleanUp();
 
+  /* Element-wise multiply of all values by a factor per stat (floored) */
+  void multiply(const FactorBlock& factors);
+
   /* Print out the values of the Attribute Set */
   void print(const bool& simple = false);
 
@@ -132,7 +152,7 @@ public:
   // /* Returns the element of the corresponding defensive statistic for an elmt */
   // static int32_t getDefensiveIndex(const Element& stat);
 
-  /* Method for returning the index of an attribute given a name */
+  /* Method for returning the index of an attribute given a name (load only) */
   static int32_t getIndex(const std::string& name);
 
   /* Returns the max value for an attribute */
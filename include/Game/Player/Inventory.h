@@ -18,6 +18,7 @@
 
 #include <algorithm>
 #include <iostream>
+#include <unordered_map>
 #include <vector>
 
 #include "EnumDb.h"
@@ -60,8 +61,28 @@ private:
   std::vector<std::pair<Item*, uint16_t>> equipments;
   std::vector<std::pair<Item*, uint16_t>> items;
 
-  /* Current Mass */
-  double curr_mass;
+  /* Game ID to first index lookups, rebuilt after an erase or a sort */
+  std::unordered_map<uint32_t, uint32_t> bubby_index;
+  std::unordered_map<uint32_t, uint32_t> item_index;
+  bool index_dirty;
+
+  /* Running totals - current mass (g), counts and stacks */
+  int64_t curr_mass;
+  uint32_t bubby_total;
+  uint32_t item_total;
+  uint32_t item_stacks;
+  uint32_t key_total;
+  uint32_t key_stacks;
+
+  /* Cached filtered views, rebuilt when first requested after a change */
+  std::vector<std::pair<Item*, uint16_t>> battle_items;
+  std::vector<std::pair<Item*, uint16_t>> key_items;
+  std::vector<Bubby*> unique_bubbies;
+  std::vector<Item*> unique_items;
+  bool views_dirty;
+
+  /* Save status - if the contents have changed since they were last saved */
+  bool save_dirty;
 
   /* Item Limitations */
   uint32_t bubby_limit;
@@ -98,8 +119,15 @@ public:
 
   /*======================== PRIVATE FUNCTIONS ===============================*/
 private:
-  /* Calculates the current mass of the Inventory */
-  void calcMass();
+  /* Appends a Bubby or Item to the end of its vector */
+  void append(Bubby* bubby, const uint16_t& count);
+  void append(Item* item, const uint16_t& count);
+
+  /* Rebuilds the game ID indexes and recounts the running totals */
+  void buildIndex();
+
+  /* Rebuilds the cached filtered views of the bubbies and items */
+  void buildViews();
 
   /* Increases the count of an item of a given game ID by a given amount */
   bool increaseCount(const uint32_t& game_id, const uint16_t& amount = 1);
@@ -107,6 +135,10 @@ private:
   /* Decreases the count of an item of a given game ID by a given amount */
   bool decreaseCount(const uint32_t& game_id, const uint16_t& amount = 1);
 
+  /* Adjusts the running totals by a count of a given Bubby or Item */
+  void tally(Bubby* bubby, const int32_t& count);
+  void tally(Item* item, const int32_t& count, const int32_t& stacks);
+
   /*========================= PUBLIC FUNCTIONS ===============================*/
 public:
   /* Attempts to add a Bubby */
@@ -132,6 +164,9 @@ public:
   /* Calcs and returns the number of spaces in the Inv. for a given Item */
   uint32_t hasRoom(Item* const item, uint32_t amount = 1);
 
+  /* Returns if the saved contents have changed since they were last saved */
+  bool isDirty();
+
   /* Load data from file */
   bool loadData(XmlData data, int index, SDL_Renderer* renderer,
                 std::string base_path);
@@ -173,7 +208,7 @@ public:
   bool removeItemUID(const uint32_t& unique_id, const uint16_t& amount = 1);
 
   /* Save data to file */
-  bool saveData(FileHandler* fh);
+  bool saveData(FileHandler* fh, std::string wrapper = "inventory");
 
   /* Sorts an object in the inventory a certain way */
   bool sort(SortType sort_by, SortObjects object_to_sort,
@@ -223,30 +258,30 @@ public:
   uint32_t getItemTotalCount(const bool& count_keys = false);
 
   /* Returns a vector of all Bubbies */
-  std::vector<std::pair<Bubby*, uint16_t>> getBubbies();
+  const std::vector<std::pair<Bubby*, uint16_t>>& getBubbies();
 
   /* Returns a vector of all equipment */
   std::vector<std::pair<Item*, uint16_t>> getEquipments();
 
   /* Returns the vector of all standard items */
-  std::vector<std::pair<Item*, uint16_t>> getItems();
+  const std::vector<std::pair<Item*, uint16_t>>& getItems();
 
   /* Returns a vector of all items useable in battle */
-  std::vector<std::pair<Item*, uint16_t>> getBattleItems();
+  const std::vector<std::pair<Item*, uint16_t>>& getBattleItems();
 
   /* Returns the vector of all key items */
-  std::vector<std::pair<Item*, uint16_t>> getKeyItems();
+  const std::vector<std::pair<Item*, uint16_t>>& getKeyItems();
 
   /* Returns a vector of each Bubby */
-  std::vector<Bubby*> getUniqueBubbies();
+  const std::vector<Bubby*>& getUniqueBubbies();
 
   /* Returns a vector of each Equipment */
   std::vector<Item*> getUniqueEquipments();
 
   /* Returns a vector of each Item */
-  std::vector<Item*> getUniqueItems();
+  const std::vector<Item*>& getUniqueItems();
 
-  /* Calculates and returns the mass */
+  /* Returns the current mass */
   double getMass();
 
   /* Returns the mass limit */
@@ -264,6 +299,9 @@ public:
   /* Assigns a description to the Inventory */
   bool setDescription(const std::string new_description);
 
+  /* Sets or clears the save dirty flag */
+  void setDirty(const bool dirty = true);
+
   void setFlag(const InvState flag, const bool set_value = true);
 
   /* Assigns new images for the backdrop and thumbnail */
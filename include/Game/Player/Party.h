@@ -75,6 +75,9 @@ private:
   /* The inventory for the party */
   Inventory* pouch;
 
+  /* Save status - if the members have changed since they were last saved */
+  bool dirty;
+
   /* ------------ Constants --------------- */
 public:
   static const uint32_t kID_BEARACKS; /* ID of player bearacks party */
@@ -166,6 +169,9 @@ public:
   /* Save data to file */
   bool saveData(FileHandler* fh, std::string wrapper = "party");
 
+  /* Saves the changed members and inventory in place under the party element */
+  bool saveDataChanged(FileHandler* fh, XmlData data_party);
+
   /* Assigns a given PartyState flag a given value */
   void setFlag(const PartyState& flag, const bool& set_value = true);
 
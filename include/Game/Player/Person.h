@@ -139,6 +139,12 @@ private:
   uint16_t level;
   uint32_t total_exp;
 
+  /* Save status - set when the saved state changes after a save. The saved
+   * VITA and QTDR are kept, since they are changed through getCurr() */
+  bool dirty;
+  int32_t save_qtdr;
+  int32_t save_vita;
+
   /* Person related sprites (non-build copies) */
   Sprite* sprite_ally;
   Sprite* sprite_ally_defensive;
@@ -181,6 +187,9 @@ private:
   /* Copy function, to be called by a copy or equal operator constructor */
   void copySelf(const Person& source);
 
+  /* Returns the current stat as written by saveData(), -1 if at max */
+  int32_t getSaveStat(const Attribute& stat);
+
   /* Loads the default values for the Person */
   void loadDefaults();
 
@@ -233,6 +242,9 @@ public:
   /* Determine the amount of experience earned this level */
   uint16_t findExpThisLevel();
 
+  /* Returns if the saved state has changed since it was last saved */
+  bool isDirty();
+
   /* Determines if the person is a power defender */
   bool isPowerDefender();
 
@@ -413,6 +425,9 @@ public:
   /* Assigns a new temp attr set */
   bool setTemp(const AttributeSet& new_temp_set);
 
+  /* Sets or clears the save dirty flag */
+  void setDirty(const bool& dirty = true);
+
   /* Assigns a new damage modifier value */
   bool setDmgMod(const float& new_dmg_mod);
 
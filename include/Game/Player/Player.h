@@ -122,8 +122,8 @@ public:
   /* Resets the play time of the player */
   void resetPlayTime();
 
-  /* Save data to file */
-  bool saveData(FileHandler* fh);
+  /* Save data to the player element. Only changes are written if not full */
+  bool saveData(FileHandler* fh, XmlData data_player, bool full = true);
 
   /* Sets the bearcks party WARNING: Possibly a dangerous function */
   void setBearacks(Party* const new_bearacks = nullptr);
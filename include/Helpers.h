@@ -292,6 +292,10 @@ public:
   static std::vector<uint32_t>
   buildExpTable(const uint32_t& min, const uint32_t& max, const uint32_t& iter);
 
+  /* Returns a single entry (1-indexed) of the table from buildExpTable() */
+  static uint32_t buildExpValue(const uint32_t& min, const uint32_t& max,
+                                const uint32_t& iter, const uint32_t& i);
+
   /* Color conversion helpers */
   static SDL_Color colorFromHex(std::string hex_color);
   static std::string colorToHex(SDL_Color color, bool alpha = false);
@@ -0,0 +1,138 @@
+/*******************************************************************************
+ * Class Name: Logger
+ * Date Created: October 19, 2026
+ * Inheritance: none
+ * Description: The logging subsystem. Messages are filtered by level, both at
+ *              compile time (LOG_LEVEL_COMPILED) and at run time per category,
+ *              before the message is even formatted. Passed messages are put
+ *              on a lock-free ring buffer and written out by a background
+ *              thread, so the caller never waits on console I/O.
+ *
+ *              Log through the LOG_DEBUG, LOG_INFO, LOG_WARNING and LOG_ERROR
+ *              macros, which take the category and a stream expression:
+ *                LOG_DEBUG(AI, "Skills Size: " << skills_size);
+ ******************************************************************************/
+#ifndef LOGGER_H
+#define LOGGER_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "EnumDb.h"
+
+/* The lowest level compiled in. Messages below it are removed entirely */
+#ifndef LOG_LEVEL_COMPILED
+#ifdef UDEBUG
+#define LOG_LEVEL_COMPILED 0
+#else
+#define LOG_LEVEL_COMPILED 1
+#endif
+#endif
+
+/* Logs the stream expression, if the level passes both filters */
+#define LOG_AT(level, category, message)                                       \
+  do                                                                           \
+  {                                                                            \
+    if((level) >= static_cast<LogLevel>(LOG_LEVEL_COMPILED) &&                \
+       Logger::isEnabled(level, category))                                     \
+    {                                                                          \
+      std::ostringstream log_stream;                                           \
+      log_stream << message;                                                   \
+      Logger::write(level, category, log_stream.str());                        \
+    }                                                                          \
+  } while(false)
+
+#define LOG_DEBUG(category, message)                                           \
+  LOG_AT(LogLevel::DEBUG, LogCategory::category, message)
+#define LOG_INFO(category, message)                                            \
+  LOG_AT(LogLevel::INFO, LogCategory::category, message)
+#define LOG_WARNING(category, message)                                         \
+  LOG_AT(LogLevel::WARNING, LogCategory::category, message)
+#define LOG_ERROR(category, message)                                           \
+  LOG_AT(LogLevel::FAULT, LogCategory::category, message)
+
+/* A single message slot in the ring buffer */
+struct LogEntry
+{
+  /* The slot sequence - which pass of the ring may write or read it */
+  std::atomic<uint32_t> sequence;
+
+  /* The message level and category */
+  LogLevel level;
+  LogCategory category;
+
+  /* The message text, truncated to fit */
+  uint16_t length;
+  char text[512];
+};
+
+class Logger
+{
+private:
+  /* The number of messages dropped as the ring buffer was full */
+  static std::atomic<uint32_t> dropped;
+
+  /* The run-time level of each category */
+  static uint8_t levels[static_cast<uint8_t>(LogCategory::COUNT)];
+
+  /* The ring buffer, and the next positions to write and to read */
+  static std::unique_ptr<LogEntry[]> ring;
+  static std::atomic<uint32_t> ring_head;
+  static uint32_t ring_tail;
+
+  /* The background writer thread and if it should keep running */
+  static std::atomic<bool> running;
+  static std::thread writer;
+
+  /* -------------------------- Constants ------------------------- */
+  const static uint8_t kIDLE_MS; /* The writer sleep while the ring is empty */
+  const static uint32_t kRING_SIZE; /* The ring slots (a power of two) */
+
+/*======================== PRIVATE FUNCTIONS ===============================*/
+private:
+  /* Writes out all messages in the ring. Returns false if it was empty */
+  static bool drain();
+
+  /* Appends the formatted message to the output for its stream */
+  static void format(LogLevel level, LogCategory category, const char* text,
+                     uint16_t length, std::string& out, std::string& err);
+
+  /* Parses a level name. Returns false if not a level */
+  static bool parseLevel(const std::string& name, LogLevel& level);
+
+  /* The writer thread loop */
+  static void run();
+
+/*========================= PUBLIC FUNCTIONS ===============================*/
+public:
+  /* Sets the run-time levels from a config string (see the definition) */
+  static void configure(const char* config);
+
+  /* Returns if a message of the level and category would be written */
+  static bool isEnabled(LogLevel level, LogCategory category);
+
+  /* Sets the run-time level of one category, or all of them */
+  static void setLevel(LogLevel level);
+  static void setLevel(LogCategory category, LogLevel level);
+
+  /* Starts the background writer. Until then, messages write directly */
+  static void start();
+
+  /* Writes out all remaining messages and stops the background writer */
+  static void stop();
+
+  /* Queues the message to be written */
+  static void write(LogLevel level, LogCategory category,
+                    const std::string& message);
+};
+
+#endif // LOGGER_H
@@ -15,6 +15,8 @@
 #include <SDL2/SDL_mixer.h>
 #include <string>
 
+#include "AssetPack.h"
+
 class Music
 {
 public:
@@ -15,9 +15,11 @@ class Fonts;
 
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_ttf.h>
+#include <future>
 #include <iostream>
 #include <string>
 
+#include "AssetPack.h"
 #include "EnumFlags.h"
 #include "FileHandler.h"
 #include "Fonts.h"
@@ -33,7 +35,8 @@ enum class OptionState
   BATTLE_ANIMATIONS = 1 << 4,
   GUI_ENABLED = 1 << 5,
   MUTE = 1 << 6, /* Do not change -- Linked to Menu */
-  FAST_BATTLE = 1 << 7
+  FAST_BATTLE = 1 << 7,
+  MAP_STREAMING = 1 << 8
 };
 
 class Options
@@ -49,8 +52,9 @@ public:
   ~Options();
 
 private:
-  /* Fonts */
+  /* Fonts, and the job creating them at start up */
   Fonts* font_data;
+  std::future<Fonts*> font_job;
 
   /* The base string path for accessing file information */
   std::string base_path;
@@ -116,6 +120,9 @@ private:
   /* Enable or disable vertical refresh syncing */
   void setVsync(bool enabled); // TODO: re-implement - should be in GIT hist
 
+  /* Waits for the fonts being created at start up, if not done */
+  void waitFonts();
+
   /*========================= PUBLIC FUNCTIONS ===============================*/
 public:
   /* Function to confirm the setup of the font */
@@ -17,6 +17,8 @@
 #include <SDL2/SDL_mixer.h>
 #include <string>
 
+#include "AssetPack.h"
+
 /* Enumerator class for sound */
 enum class SoundChannels : int
 {
@@ -186,6 +188,9 @@ public:
   /* Set the sound to loop infinitely, until stop() is called */
   void setLoopForever();
 
+  /* Sets the decoded sound chunk, which the sound takes ownership of */
+  bool setSoundChunk(Mix_Chunk* chunk);
+
   /* Trys to set the sound file to the given path */
   bool setSoundFile(std::string path);
 
@@ -207,6 +212,9 @@ public:
   /* Returns channel int corresponding to the channel enum */
   static int getChannelInt(SoundChannels channel);
 
+  /* Decodes the sound file at the path. Safe to call on a worker thread */
+  static Mix_Chunk* loadChunk(std::string path);
+
   /* Status if given channel input is playing */
   static bool isChannelPlaying(int channel);
   static bool isChannelPlaying(SoundChannels channel);
@@ -9,7 +9,11 @@
 #ifndef SOUNDHANDLER_H
 #define SOUNDHANDLER_H
 
+#include <algorithm>
+#include <atomic>
+#include <future>
 #include <map>
+#include <thread>
 
 #include "Sound.h"
 #include "XmlData.h"
@@ -36,8 +40,12 @@ private:
   /* Queue */
   std::vector<SoundQueue> queue;
 
+  /* Sound files read in by load, to be decoded by loadFinish */
+  std::vector<std::pair<Sound*, std::string>> load_queue;
+
   /* --------------------- CONSTANTS --------------------- */
   // const static short kINFINITE_LOOP; /* Infinite loop special character */
+  const static uint8_t kLOAD_THREADS; /* Max threads decoding sound files */
 
   /*======================== PRIVATE FUNCTIONS ===============================*/
 private:
@@ -48,6 +56,9 @@ private:
   /* Clean up the queue - pre-processing */
   void queueCleanUp();
 
+  /* Removes the queued file decodes for the sound chunk */
+  void unqueueLoad(Sound* chunk);
+
 /*========================= PUBLIC FUNCTIONS ===============================*/
 public:
   /* Add sound files */
@@ -68,6 +79,9 @@ public:
   /* Load data from file */
   bool load(XmlData data, int index, std::string base_path);
 
+  /* Decodes the sound files read in by load, across worker threads */
+  bool loadFinish();
+
   /* Process the queue */
   void process();
 
@@ -13,6 +13,8 @@
 #define SPRITE_H
 
 #include <iostream>
+#include <map>
+#include <memory>
 #include <vector>
 
 #include "Helpers.h"
@@ -30,7 +32,12 @@ enum Sequencer
 struct SpriteData
 {
   /* Construct a SpriteData object */
-  SpriteData() : build_path_head{""}, build_path_tail{""}, build_frames{0} {};
+  SpriteData()
+      : build_path_head{""},
+        build_path_tail{""},
+        build_frames{0},
+        build_angle{0},
+        build_adjustments{} {};
 
   /* Path to the head of the frames */
   std::string build_path_head;
@@ -40,6 +47,10 @@ struct SpriteData
 
   /* Number of frames to construct */
   int32_t build_frames;
+
+  /* Rotation and image adjustments to apply to the constructed frames */
+  uint16_t build_angle;
+  std::vector<std::string> build_adjustments;
 };
 
 class Sprite
@@ -74,6 +85,10 @@ public:
   };
 
 private:
+  /* The shared animation clock (ms) that drives the frame, if set */
+  const uint32_t* animation_clock;
+  int clock_position;
+
   /* Time to complete animation */
   uint16_t animation_time;
 
@@ -103,6 +118,9 @@ private:
   /* Elapsed time of animation */
   uint16_t elapsed_time;
 
+  /* The frames built from data, shared with every sprite of the same data */
+  std::shared_ptr<Frame> frames_shared;
+
   /* Freeze the sprite at tail for update calls */
   bool freeze_tail;
 
@@ -141,10 +159,14 @@ private:
   SDL_Rect src_rect;
   bool src_rect_use;
 
-  /* The texture with the presently displayed frame + modifications */
+  /* The texture with the presently displayed frame + modifications. Only
+   * created when the frame needs compositing (transition or brightening) */
   SDL_Texture* texture;
   bool texture_update;
 
+  /* The built frame sequences, by sprite data key */
+  static std::map<std::string, std::weak_ptr<Frame>> frame_cache;
+
   /*------------------- Constants -----------------------*/
   const static uint8_t kDOUBLE_DIGITS;  /* the borderline to double digits */
   const static double kMAX_BRIGHTNESS;  /* The max brightness value */
@@ -160,11 +182,30 @@ public:
 
   /*======================== PRIVATE FUNCTIONS ===============================*/
 private:
+  /* Returns the key of the build data, for sharing the built frames */
+  std::string getDataKey() const;
+
+  /* Returns if the current frame needs to be composited in the texture */
+  bool isComposited() const;
+
   /* Returns the angle, if one exists in the list of modifications */
   uint16_t parseAdjustments(std::vector<std::string> adjustments);
 
   /* Sets the color modification with the texture */
   void setColorMod();
+  void setColorMod(SDL_Texture* target);
+
+  /* Drops the shared frames, leaving the sprite with no frames */
+  void releaseShared();
+
+  /* Sets the color mode of the sprite on the given (shared) frame */
+  void setFrameColor(Frame* frame);
+
+  /* Shifts to the frame that the animation clock currently points to */
+  void syncToClock();
+
+  /* Deletes the circular list of frames starting at head */
+  static void deleteFrames(Frame* head);
 
   /*======================= PROTECTED FUNCTIONS ==============================*/
 protected:
@@ -181,7 +222,7 @@ public:
                           std::string base_path = "", bool no_warnings = false,
                           bool build_data = true);
 
-  /* Creates a texture for a sprite (for Pleps) */
+  /* Creates the compositing texture for a sprite, if it needs one */
   void createTexture(SDL_Renderer* renderer);
 
   /* Executes the necessary image adjustments, to all frames */
@@ -284,9 +325,15 @@ public:
   /* Check if there are set frames in the sprite */
   bool isFramesSet() const;
 
+  /* Returns if the sprite data has been built (or has nothing to build) */
+  bool isLoaded() const;
+
   /* Load the sprite data, build textures/frames */
   bool loadData(SDL_Renderer* renderer);
 
+  /* Releases the built frames so they are rebuilt from data on next load */
+  bool unloadData();
+
   /* Removes the frame in the sequence at the given position */
   bool remove(int position);
 
@@ -306,6 +353,9 @@ public:
   /* Take the temp. stored color balance values and restore them */
   void revertColorBalance();
 
+  /* Sets the shared animation clock, which drives the frames on render */
+  void setAnimationClock(const uint32_t* clock);
+
   /* Sets the frame animation time (in ms) */
   void setAnimationTime(uint16_t time);
 
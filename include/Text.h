@@ -11,7 +11,9 @@
 
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_ttf.h>
+#include <unordered_map>
 
+#include "AssetPack.h"
 #include "Helpers.h"
 
 using std::vector;
@@ -65,7 +67,16 @@ private:
   /* The width of the texture */
   int width;
 
+  /* Shaping caches, shared by all text. The measured width of each string
+   * and the split lines of each wrapped string, keyed by font and style */
+  static std::unordered_map<string, int> cache_sizes;
+  static std::unordered_map<string, vector<string>> cache_lines;
+  static std::unordered_map<string,
+                            vector<vector<vector<pair<string, TextProperty>>>>>
+      cache_lines_property;
+
   /*------------------- Constants -----------------------*/
+  const static uint16_t kCACHE_MAX; /* Max entries in each shaping cache */
   const static uint8_t kDEFAULT_ALPHA; /* The default alpha rating */
 
   /*========================= PUBLIC FUNCTIONS ===============================*/
@@ -109,6 +120,18 @@ public:
   void unsetFont();
   void unsetTexture();
 
+  /*===================== PRIVATE STATIC FUNCTIONS ==========================*/
+private:
+  /* Returns the cache key of the font face, size and current style */
+  static string fontKey(TTF_Font* font);
+
+  /* Returns the cache key of a wrapped string */
+  static string lineKey(TTF_Font* font, const string& text, int line_width,
+                        int elide_count);
+
+  /* Measures the width of the text in the font, cached after the first */
+  static bool sizeText(TTF_Font* font, const string& text, int* width);
+
   /*===================== PUBLIC STATIC FUNCTIONS ===========================*/
 public:
   /* Returns the length of the text passed in */
@@ -134,6 +157,10 @@ public:
   /* Parse the html information within the text set and return the property */
   static vector<pair<string, TextProperty>> parseHtml(string text);
 
+  /* Returns the rendered width of each visible character count of a line */
+  static vector<int> revealWidths(TTF_Font* font,
+                      const vector<vector<pair<string, TextProperty>>>& line);
+
   /* Takes a string of characters and splits it to fit a line after it is
    * rendered by the given font. */
   static vector<string> splitLine(TTF_Font* font, std::string text,
@@ -0,0 +1,51 @@
+/*******************************************************************************
+ * Class Name: Timeline
+ * Date Created: October 19, 2026
+ * Inheritance: none
+ * Description: The startup timeline. Each phase of the start up sequence is
+ *              marked as it completes and the full timeline, up to the first
+ *              render of the title screen, is reported once on every run.
+ *              Marks are only made from the main thread.
+ ******************************************************************************/
+#ifndef TIMELINE_H
+#define TIMELINE_H
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Helpers.h"
+
+class Timeline
+{
+private:
+  /* Is the timeline still recording */
+  static bool active;
+
+  /* The time at the last mark, in seconds from the start */
+  static double last;
+
+  /* The completed phases and their durations, in seconds */
+  static std::vector<std::pair<std::string, double>> phases;
+
+  /* The timer from the start of the run */
+  static Timer start;
+
+  /* -------------------------- Constants ------------------------- */
+  const static uint8_t kNAME_WIDTH; /* The width of the phase name column */
+
+/*========================= PUBLIC FUNCTIONS ===============================*/
+public:
+  /* Returns if the timeline is still recording */
+  static bool isActive();
+
+  /* Marks the end of a phase, started at the previous mark */
+  static void mark(const std::string& phase);
+
+  /* Reports the timeline and stops recording */
+  static void report();
+};
+
+#endif // TIMELINE_H
@@ -50,6 +50,9 @@ public:
   /* Title in corner */
   Text title;
 
+  /* -------------------------- Constants ------------------------- */
+  const static std::string kBACKGROUND; /* The background image path */
+
 public:
   /* Construct the Sprites */
   void buildSprites(Options* config, SDL_Renderer* renderer);
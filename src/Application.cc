@@ -281,6 +281,11 @@ bool Application::load()
         }
       }
     } while(!done && success);
+    Timeline::mark("App data");
+
+    /* Decode all the music/sounds read in, across worker threads */
+    success &= sound_handler.loadFinish();
+    Timeline::mark("Sound decode");
 
     /* Print out the time to create all the music/sounds */
     std::cout << "App Load Time: " << t.elapsed() << "s" << std::endl;
@@ -293,10 +298,12 @@ bool Application::load()
   if(success)
   {
     game_handler->setPath(app_path, app_directory, app_map, false);
+    Timeline::mark("Game data");
 
     /* Change mode back to title screen */
     title_screen.setSaveData(game_handler->getSaveData());
     title_screen.buildSave(renderer);
+    Timeline::mark("Save list");
 
     changeMode(TITLESCREEN);
   }
@@ -546,6 +553,13 @@ bool Application::initialize()
   /* Only proceed if successful */
   if(success)
   {
+    /* Decode the start up images while the window and renderer are created.
+     * Only the texture uploads wait for the renderer */
+    std::string base_path = system_options->getBasePath();
+    AssetPack::prefetchImage(base_path + kLOGO_ICON);
+    AssetPack::prefetchImage(base_path + kLOADING_SCREEN);
+    AssetPack::prefetchImage(base_path + TitleBackground::kBACKGROUND);
+
     /* Create window for display */
     uint32_t flags = SDL_WINDOW_SHOWN;
     if(system_options->isFullScreen())
@@ -566,9 +580,10 @@ bool Application::initialize()
     else
     {
       std::string icon_path = system_options->getBasePath() + kLOGO_ICON;
-      SDL_Surface* surface = IMG_Load(icon_path.c_str());
+      SDL_Surface* surface = AssetPack::loadImage(icon_path);
       SDL_SetWindowIcon(window, surface);
     }
+    Timeline::mark("Window");
   }
 
   /* Create the renderer for the window */
@@ -639,6 +654,8 @@ bool Application::initialize()
       renderer = SDL_CreateRenderer(window, -1, flags);
     }
 
+    Timeline::mark("Renderer");
+
     if(renderer == NULL)
     {
       std::cerr << "[ERROR] Renderer could not be created. SDL error: "
@@ -661,6 +678,7 @@ bool Application::initialize()
 
       /* Set render color */
       SDL_SetRenderDrawColor(renderer, 0x00, 0x00, 0x00, 0xFF);
+      Timeline::mark("Start up images");
     }
   }
 
@@ -671,6 +689,7 @@ bool Application::initialize()
               << "issue or the font files are missing or invalid." << std::endl;
     success = false;
   }
+  Timeline::mark("Fonts");
 
   /* If successful, attempt final load sequence */
   if(success)
@@ -752,6 +771,13 @@ bool Application::run(bool skip_title)
 
         /* Update screen */
         SDL_RenderPresent(renderer);
+
+        /* The start up is done once the first title or game frame shows */
+        if(Timeline::isActive() && (mode == TITLESCREEN || mode == GAME))
+        {
+          Timeline::mark("First frame");
+          Timeline::report();
+        }
       }
 
       count++;
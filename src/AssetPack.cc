@@ -0,0 +1,483 @@
+/*******************************************************************************
+ * Class Name: AssetPack
+ * Date Created: October 19, 2026
+ * Inheritance: none
+ * Description: A single indexed archive of the game assets. The pack is mapped
+ *              into memory once and each asset opens from it as a SDL_RWops,
+ *              so loading does not open or stat a file per asset. Images are
+ *              stored decoded and skip the image decode as well. Any asset not
+ *              in the pack loads from the loose file as before.
+ *
+ * Notes
+ * -----
+ *
+ * [1]: The pack layout, all values little endian:
+ *        - magic "FISEPAK1" and the uint32 entry count
+ *        - each entry: uint16 path length, path, uint32 format, uint32 width,
+ *          uint32 height, uint64 offset, uint64 size
+ *        - the data of each entry. Decoded images are the rows of pixels,
+ *          without padding, in the stored pixel format
+ * [2]: Frame rotations are not baked into the pack. The angle comes from the
+ *      sprite data, not the image, and is applied on the loaded surface.
+ ******************************************************************************/
+#include "AssetPack.h"
+
+#include <dirent.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/* Constant Implementation - see header file for descriptions */
+const std::string AssetPack::kIMAGE_EXT = ".png";
+const std::string AssetPack::kMAGIC = "FISEPAK1";
+const std::string AssetPack::kPACK_FILE = "assets.pak";
+
+/* Static Implementation - see header file for descriptions */
+std::string AssetPack::base_path = "";
+uint8_t* AssetPack::data = nullptr;
+uint64_t AssetPack::data_size = 0;
+bool AssetPack::data_mapped = false;
+std::unordered_map<std::string, AssetPackEntry> AssetPack::entries;
+std::unordered_map<std::string, std::future<SDL_Surface*>>
+    AssetPack::prefetched;
+
+/*=============================================================================
+ * PRIVATE FUNCTIONS
+ *============================================================================*/
+
+/*
+ * Description: Decodes the image at the path. Decoded images in the pack are
+ *              copied straight into a new surface, packed files are decoded
+ *              from memory and everything else loads from the loose file.
+ *              Only reads the mounted pack, so is safe on a worker thread.
+ *
+ * Inputs: const std::string& path - the path to the image
+ * Output: SDL_Surface* - the decoded surface. Null if it failed
+ */
+SDL_Surface* AssetPack::decodeImage(const std::string& path)
+{
+  const AssetPackEntry* entry = findEntry(path);
+
+  if(entry != nullptr && entry->format != 0)
+  {
+    int bpp;
+    uint32_t r_mask, g_mask, b_mask, a_mask;
+    SDL_PixelFormatEnumToMasks(entry->format, &bpp, &r_mask, &g_mask, &b_mask,
+                               &a_mask);
+
+    SDL_Surface* surface =
+        SDL_CreateRGBSurface(0, entry->width, entry->height, bpp, r_mask,
+                             g_mask, b_mask, a_mask);
+    if(surface != nullptr)
+    {
+      uint64_t row = static_cast<uint64_t>(entry->width) * 4;
+      for(uint32_t i = 0; i < entry->height; i++)
+        memcpy(static_cast<uint8_t*>(surface->pixels) + i * surface->pitch,
+               data + entry->offset + i * row, row);
+    }
+    return surface;
+  }
+  else if(entry != nullptr)
+  {
+    return IMG_Load_RW(openFile(path), 1);
+  }
+
+  return IMG_Load(path.c_str());
+}
+
+/*
+ * Description: Returns the entry of the asset at the path. The path may be
+ *              full, from the base path, or already relative to it.
+ *
+ * Inputs: const std::string& path - the path to the asset
+ * Output: const AssetPackEntry* - the entry. Null if not in the pack
+ */
+const AssetPackEntry* AssetPack::findEntry(const std::string& path)
+{
+  if(entries.empty())
+    return nullptr;
+
+  auto found = entries.end();
+  if(!base_path.empty() && path.compare(0, base_path.size(), base_path) == 0)
+    found = entries.find(path.substr(base_path.size()));
+  else
+    found = entries.find(path);
+
+  if(found != entries.end())
+    return &found->second;
+  return nullptr;
+}
+
+/*
+ * Description: Appends the paths of all files under the directory, walking
+ *              into each sub directory. The paths are relative to the base.
+ *
+ * Inputs: const std::string& base - the base path
+ *         const std::string& dir - the directory, relative to the base
+ *         std::vector<std::string>& files - the list of paths to append to
+ * Output: none
+ */
+void AssetPack::listFiles(const std::string& base, const std::string& dir,
+                          std::vector<std::string>& files)
+{
+  DIR* handle = opendir((base + dir).c_str());
+  if(handle != nullptr)
+  {
+    std::vector<std::string> names;
+    struct dirent* item;
+    while((item = readdir(handle)) != nullptr)
+    {
+      std::string name = item->d_name;
+      if(name != "." && name != "..")
+        names.push_back(name);
+    }
+    closedir(handle);
+
+    /* Sorted, so the same assets always build the same pack */
+    std::sort(names.begin(), names.end());
+    for(auto& name : names)
+    {
+      std::string path = dir + "/" + name;
+      DIR* sub_handle = opendir((base + path).c_str());
+      if(sub_handle != nullptr)
+      {
+        closedir(sub_handle);
+        listFiles(base, path, files);
+      }
+      else
+      {
+        files.push_back(path);
+      }
+    }
+  }
+}
+
+/*=============================================================================
+ * PUBLIC FUNCTIONS
+ *============================================================================*/
+
+/*
+ * Description: Builds a pack of all the files under the directory. Images
+ *              are decoded into 32 bit pixels, all other files are stored as
+ *              is. The index is written once all the data sizes are known.
+ *
+ * Inputs: const std::string& base - the base path, that paths are relative to
+ *         const std::string& dir - the directory to pack, relative to the base
+ *         const std::string& pack_path - the path of the pack to write
+ * Output: bool - true if the pack was written
+ */
+bool AssetPack::build(const std::string& base, const std::string& dir,
+                      const std::string& pack_path)
+{
+  std::vector<std::string> files;
+  listFiles(base, dir, files);
+  if(files.empty())
+  {
+    std::cerr << "[ERROR] No assets found to pack in: " << base + dir
+              << std::endl;
+    return false;
+  }
+
+  SDL_RWops* pack = SDL_RWFromFile(pack_path.c_str(), "wb");
+  if(pack == nullptr)
+  {
+    std::cerr << "[ERROR] Unable to write asset pack: " << pack_path
+              << ". SDL error: " << SDL_GetError() << std::endl;
+    return false;
+  }
+
+  /* The index is a fixed size per path, so the data can start after it */
+  uint64_t offset = kMAGIC.size() + sizeof(uint32_t);
+  for(auto& file : files)
+    offset += sizeof(uint16_t) + file.size() + 3 * sizeof(uint32_t) +
+              2 * sizeof(uint64_t);
+
+  std::vector<AssetPackEntry> index;
+  bool success = true;
+  SDL_RWseek(pack, offset, RW_SEEK_SET);
+
+  for(auto& file : files)
+  {
+    AssetPackEntry entry = {offset, 0, 0, 0, 0};
+    std::string path = base + file;
+    bool image = (file.size() > kIMAGE_EXT.size() &&
+                  file.compare(file.size() - kIMAGE_EXT.size(),
+                               kIMAGE_EXT.size(), kIMAGE_EXT) == 0);
+
+    /* Images - decoded to 32 bit rows */
+    SDL_Surface* surface = image ? IMG_Load(path.c_str()) : nullptr;
+    if(surface != nullptr && surface->format->BytesPerPixel != 4)
+    {
+      SDL_Surface* converted =
+          SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_ARGB8888, 0);
+      SDL_FreeSurface(surface);
+      surface = converted;
+    }
+
+    if(surface != nullptr)
+    {
+      entry.format = surface->format->format;
+      entry.width = surface->w;
+      entry.height = surface->h;
+      entry.size = static_cast<uint64_t>(surface->w) * surface->h * 4;
+
+      SDL_LockSurface(surface);
+      for(int i = 0; i < surface->h; i++)
+        SDL_RWwrite(pack, static_cast<uint8_t*>(surface->pixels) +
+                              i * surface->pitch,
+                    surface->w * 4, 1);
+      SDL_UnlockSurface(surface);
+      SDL_FreeSurface(surface);
+    }
+    /* All other files - copied as is */
+    else
+    {
+      SDL_RWops* source = SDL_RWFromFile(path.c_str(), "rb");
+      if(source == nullptr)
+      {
+        std::cerr << "[ERROR] Unable to read asset to pack: " << path
+                  << std::endl;
+        success = false;
+        break;
+      }
+
+      uint8_t buffer[16384];
+      size_t read;
+      while((read = SDL_RWread(source, buffer, 1, sizeof(buffer))) > 0)
+      {
+        SDL_RWwrite(pack, buffer, 1, read);
+        entry.size += read;
+      }
+      SDL_RWclose(source);
+    }
+
+    index.push_back(entry);
+    offset += entry.size;
+  }
+
+  /* Finally, the header and index at the start of the pack */
+  if(success)
+  {
+    SDL_RWseek(pack, 0, RW_SEEK_SET);
+    SDL_RWwrite(pack, kMAGIC.c_str(), 1, kMAGIC.size());
+    SDL_WriteLE32(pack, index.size());
+    for(uint32_t i = 0; i < index.size(); i++)
+    {
+      SDL_WriteLE16(pack, files[i].size());
+      SDL_RWwrite(pack, files[i].c_str(), 1, files[i].size());
+      SDL_WriteLE32(pack, index[i].format);
+      SDL_WriteLE32(pack, index[i].width);
+      SDL_WriteLE32(pack, index[i].height);
+      SDL_WriteLE64(pack, index[i].offset);
+      SDL_WriteLE64(pack, index[i].size);
+    }
+
+    std::cout << "[NOTIFICATION] Packed " << index.size() << " assets into "
+              << pack_path << std::endl;
+  }
+
+  SDL_RWclose(pack);
+  return success;
+}
+
+/*
+ * Description: Returns if a pack is currently mounted.
+ *
+ * Inputs: none
+ * Output: bool - true if mounted
+ */
+bool AssetPack::isMounted()
+{
+  return (data != nullptr);
+}
+
+/*
+ * Description: Loads the image at the path. An image prefetched with
+ *              prefetchImage() is taken from its worker, otherwise it is
+ *              decoded now. The surface is writable and owned by the caller.
+ *              Only called from the main thread.
+ *
+ * Inputs: const std::string& path - the path to the image
+ * Output: SDL_Surface* - the loaded surface. Null if it failed
+ */
+SDL_Surface* AssetPack::loadImage(const std::string& path)
+{
+  auto found = prefetched.find(path);
+  if(found != prefetched.end())
+  {
+    SDL_Surface* surface = found->second.get();
+    prefetched.erase(found);
+    return surface;
+  }
+
+  return decodeImage(path);
+}
+
+/*
+ * Description: Mounts the pack. The file is mapped into memory where the
+ *              platform supports it and read in whole otherwise. Any pack
+ *              already mounted is unmounted first.
+ *
+ * Inputs: const std::string& base - the base path the asset paths are from
+ *         const std::string& pack_path - the path of the pack file
+ * Output: bool - true if the pack was mounted
+ */
+bool AssetPack::mount(const std::string& base, const std::string& pack_path)
+{
+  unmount();
+
+#ifndef _WIN32
+  int fd = open(pack_path.c_str(), O_RDONLY);
+  if(fd < 0)
+    return false;
+
+  struct stat info;
+  if(fstat(fd, &info) == 0 && info.st_size > 0)
+  {
+    void* mapped = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if(mapped != MAP_FAILED)
+    {
+      data = static_cast<uint8_t*>(mapped);
+      data_size = info.st_size;
+      data_mapped = true;
+    }
+  }
+  close(fd);
+#else
+  SDL_RWops* file = SDL_RWFromFile(pack_path.c_str(), "rb");
+  if(file == nullptr)
+    return false;
+
+  Sint64 size = SDL_RWsize(file);
+  if(size > 0)
+  {
+    data = new uint8_t[size];
+    data_size = size;
+    if(SDL_RWread(file, data, size, 1) != 1)
+      unmount();
+  }
+  SDL_RWclose(file);
+#endif
+
+  if(data == nullptr)
+    return false;
+
+  /* Parse the index */
+  bool success = (data_size > kMAGIC.size() + sizeof(uint32_t) &&
+                  kMAGIC.compare(0, kMAGIC.size(),
+                                 reinterpret_cast<char*>(data),
+                                 kMAGIC.size()) == 0);
+  if(success)
+  {
+    SDL_RWops* index = SDL_RWFromConstMem(data, data_size);
+    SDL_RWseek(index, kMAGIC.size(), RW_SEEK_SET);
+    uint32_t count = SDL_ReadLE32(index);
+
+    for(uint32_t i = 0; success && i < count; i++)
+    {
+      std::string path(SDL_ReadLE16(index), '\0');
+      success &= (SDL_RWread(index, &path[0], 1, path.size()) == path.size());
+
+      AssetPackEntry entry;
+      entry.format = SDL_ReadLE32(index);
+      entry.width = SDL_ReadLE32(index);
+      entry.height = SDL_ReadLE32(index);
+      entry.offset = SDL_ReadLE64(index);
+      entry.size = SDL_ReadLE64(index);
+      success &= (entry.offset <= data_size &&
+                  entry.size <= data_size - entry.offset);
+
+      /* A decoded image is copied out four bytes a pixel, so the entry must
+       * hold all of them */
+      if(entry.format != 0)
+        success &= (SDL_BYTESPERPIXEL(entry.format) == 4 &&
+                    entry.width > 0 && entry.height > 0 &&
+                    static_cast<uint64_t>(entry.width) * entry.height * 4 <=
+                        entry.size);
+
+      entries[path] = entry;
+    }
+    SDL_RWclose(index);
+  }
+
+  if(!success)
+  {
+    std::cerr << "[ERROR] Invalid asset pack: " << pack_path << std::endl;
+    unmount();
+    return false;
+  }
+
+  base_path = base;
+  return true;
+}
+
+/*
+ * Description: Opens a read stream of the asset in the pack. The stream reads
+ *              straight from the pack memory and is closed by the caller.
+ *
+ * Inputs: const std::string& path - the path to the asset
+ * Output: SDL_RWops* - the stream. Null if the asset is not in the pack
+ */
+SDL_RWops* AssetPack::openFile(const std::string& path)
+{
+  const AssetPackEntry* entry = findEntry(path);
+  if(entry != nullptr)
+    return SDL_RWFromConstMem(data + entry->offset, entry->size);
+  return nullptr;
+}
+
+/*
+ * Description: Starts decoding the image at the path on a worker thread. The
+ *              next loadImage() of the path takes the surface, waiting if the
+ *              decode has not finished. Only called from the main thread.
+ *
+ * Inputs: const std::string& path - the path to the image
+ * Output: none
+ */
+void AssetPack::prefetchImage(const std::string& path)
+{
+  if(prefetched.find(path) == prefetched.end())
+    prefetched[path] = std::async(std::launch::async, decodeImage, path);
+}
+
+/*
+ * Description: Unmounts the pack, clears the index and frees any images
+ *              prefetched but never loaded. All streams opened from the pack
+ *              and fonts or music reading from them must be closed first.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void AssetPack::unmount()
+{
+  /* The prefetches may be reading the pack */
+  for(auto& prefetch : prefetched)
+  {
+    SDL_Surface* surface = prefetch.second.get();
+    if(surface != nullptr)
+      SDL_FreeSurface(surface);
+  }
+  prefetched.clear();
+
+  if(data != nullptr)
+  {
+#ifndef _WIN32
+    if(data_mapped)
+      munmap(data, data_size);
+    else
+      delete[] data;
+#else
+    delete[] data;
+#endif
+  }
+
+  base_path = "";
+  data = nullptr;
+  data_mapped = false;
+  data_size = 0;
+  entries.clear();
+}
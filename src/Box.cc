@@ -176,10 +176,12 @@ bool Box::renderBar(SDL_Renderer* renderer)
 
     /* Render the border */
     Frame::setRenderDrawColor(renderer, color_border);
+    Frame::batchBegin();
     Frame::drawLine(top_bar, renderer);
     Frame::drawLine(left_bar, renderer);
     Frame::drawLine(bot_bar, renderer);
     Frame::drawLine(right_bar, renderer);
+    Frame::batchEnd(renderer);
   }
 
   return success;
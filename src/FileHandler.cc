@@ -57,6 +57,7 @@ const int      FileHandler::kLONG_BUFFER     = 0xFF;
 const int      FileHandler::kMAX_ASCII       = 255;
 const int      FileHandler::kMIN_LINE        = 16;
 const int      FileHandler::kPADDING_ASCII   = 200;
+const std::string FileHandler::kSNAPSHOT_TEMP = ".tmp";
 const int      FileHandler::kXXTEA_ROUNDS    = 19;
 
 /*============================================================================
@@ -1127,24 +1128,23 @@ tinyxml2::XMLNode* FileHandler::findElement(XmlData data, bool save_location)
     /* Loop through all elements */
     while(!done && index < limit)
     {
-      /* Find if a child element matches */
-      tinyxml2::XMLElement* ele =
-                        node->FirstChildElement(data.getElement(index).c_str());
-      if(ele != nullptr)
+      /* Find if a child element matches, checking the attribute of each
+       * sibling with the same name if relevant */
+      std::string name = data.getElement(index);
+      tinyxml2::XMLElement* ele = node->FirstChildElement(name.c_str());
+      while(ele != nullptr && !data.getKey(index).empty())
       {
-        /* Check the attribute if relevant */
         const tinyxml2::XMLAttribute* attr = ele->FirstAttribute();
-        if(data.getKey(index).empty() ||
-           (attr != nullptr && attr->Name() == data.getKey(index)
-                            && attr->Value() == data.getKeyValue(index)))
-        {
-          node = ele;
-          index++;
-        }
-        else
-        {
-          done = true;
-        }
+        if(attr != nullptr && attr->Name() == data.getKey(index)
+                           && attr->Value() == data.getKeyValue(index))
+          break;
+        ele = ele->NextSiblingElement(name.c_str());
+      }
+
+      if(ele != nullptr)
+      {
+        node = ele;
+        index++;
       }
       else
       {
@@ -1224,6 +1224,34 @@ FileHandler::FileType FileHandler::getFileType()
   return file_type;
 }
 
+/*
+ * Description: Returns the current XML write set as the printed output that
+ *              would be written to the file. The date is updated first, as
+ *              in save(). The document is left open, so it can be written to
+ *              again while the output is written by writeXmlSnapshot().
+ *
+ * Inputs: none
+ * Output: std::string - the XML output. Empty if not an open XML write
+ */
+std::string FileHandler::getXmlSnapshot()
+{
+  if(available && file_write && file_type == XML)
+  {
+    /* Update current date */
+    file_date = getCurrentDate();
+    XmlData date_data(file_date);
+    date_data.addElement("date");
+    writeXmlDataSet(date_data);
+
+    /* Print the document */
+    tinyxml2::XMLPrinter printer;
+    xml_document->Print(&printer);
+    return std::string(printer.CStr());
+  }
+
+  return "";
+}
+
 /*
  * Description: Returns if the class is available to read or write from.
  *              If false is returned, the read and write calls will not
@@ -1392,6 +1420,33 @@ XmlData FileHandler::readXmlData(bool* done, bool* success)
   return data;
 }
 
+/*
+ * Description: Finds the element sequence defined in the XmlData set (not
+ *              including the data entry) and removes the element, along with
+ *              all of its children. It has the capacity to save the location
+ *              of the parent to the active node pointer.
+ *
+ * Inputs: XmlData data - the data class to define the node sequence
+ *         bool save_location - save the parent location to active
+ * Output: bool - true if the element was removed
+ */
+bool FileHandler::removeElement(XmlData data, bool save_location)
+{
+  /* Find the node to remove */
+  tinyxml2::XMLNode* node = findElement(data);
+  if(node != nullptr && node != xml_document)
+  {
+    tinyxml2::XMLNode* parent_node = node->Parent();
+    parent_node->DeleteChild(node);
+    if(save_location)
+      xml_node = parent_node;
+
+    return true;
+  }
+
+  return false;
+}
+
 /*
  * Description: Saves the current write set to the file. This will not close
  *              the document and just returns if the save was successful.
@@ -1402,7 +1457,7 @@ XmlData FileHandler::readXmlData(bool* done, bool* success)
  */
 bool FileHandler::save()
 {
-  if(available && file_write)
+  if(available && file_write && file_stream.is_open())
   {
     bool success = true;
 
@@ -1617,6 +1672,61 @@ bool FileHandler::start(bool read_before_write)
   return false;
 }
 
+/*
+ * Description: Starts an XML write that only holds the document in memory. The
+ *              document is read from the file, if it exists and read_file is
+ *              set. Otherwise, it starts empty and replaces the file when
+ *              written. Unlike start(), no temporary file or stream is opened,
+ *              so nothing is held open on disk between writes. The document is
+ *              written out with getXmlSnapshot() and writeXmlSnapshot().
+ *
+ * Inputs: bool read_file - read the existing file into the document. Default
+ *                          true
+ * Output: bool - true if the document is now available to be written to
+ */
+bool FileHandler::startDocument(bool read_file)
+{
+  if(!file_name.empty() && file_write && file_type == XML)
+  {
+    /* Stop the system first if it's already running */
+    if(available)
+      stop(true);
+
+    file_data.clear();
+    file_name_temp = "";
+    available = true;
+
+    /* Read the document and push the index to the end */
+    xml_document = new tinyxml2::XMLDocument();
+    xml_node = xml_document;
+    bool success = xmlReadStart(read_file);
+    xmlToTail();
+
+    /* Write starting date */
+    if(success)
+    {
+      file_date = getCurrentDate();
+      if(xml_document->NoChildren())
+      {
+        success &= writeXmlData("date", VarType::STRING, file_date);
+      }
+      else
+      {
+        XmlData date_data(file_date);
+        date_data.addElement("date");
+        writeXmlDataSet(date_data);
+      }
+    }
+
+    if(!success)
+      stop(true);
+
+    return success;
+  }
+
+  return false;
+}
+
 /*
  * Description: Stops the class, after it is was run. If the class was never
  *              started, this call does nothing except for a reclearing of
@@ -1644,7 +1754,7 @@ bool FileHandler::stop(bool failed)
   available = false;
 
   /* If file write, delete temporary */
-  if(file_write)
+  if(file_write && !file_name_temp.empty())
     fileDelete(file_name_temp);
 
   /* Do the final clean up once everything is stopped */
@@ -2062,3 +2172,68 @@ std::string FileHandler::getCurrentDate(std::string format)
 
   return time_string;
 }
+
+/*
+ * Description: Writes the XML output from getXmlSnapshot() to the file, in
+ *              the same format as save(): line by line, with the MD5 line on
+ *              top if encrypted. It is written to a temporary file first and
+ *              then renamed over the file, so a failed write never replaces
+ *              a good file. No class state is used, so this can run on a
+ *              worker thread.
+ *
+ * Inputs: std::string filename - the file to write
+ *         std::string output - the XML output
+ *         bool encryption - should the lines be encrypted
+ * Output: bool - true if the file was written
+ */
+bool FileHandler::writeXmlSnapshot(std::string filename, std::string output,
+                                   bool encryption)
+{
+  if(filename.empty() || output.empty())
+    return false;
+
+  FileHandler encrypter;
+  std::string file_name_temp = filename + kSNAPSHOT_TEMP;
+  std::vector<std::string> output_lines = Helpers::split(output, '\n');
+  bool success = true;
+
+  std::ofstream write_stream(file_name_temp.c_str(),
+                             std::ios::out | std::ios::binary | std::ios::trunc);
+  if(!write_stream.good())
+    return false;
+
+  /* MD5 write - if encryption is enabled */
+  if(encryption)
+  {
+    std::string data;
+    for(auto& line : output_lines)
+      data.append(line);
+    write_stream << encrypter.encryptLine(MD5::compute(data), &success)
+                 << std::endl;
+  }
+
+  /* Write each line to the file */
+  for(auto& line : output_lines)
+  {
+    bool line_success = true;
+
+    if(encryption)
+      write_stream << encrypter.encryptLine(line, &line_success) << std::endl;
+    else
+      write_stream << line << std::endl;
+
+    success &= line_success;
+  }
+
+  success &= write_stream.good();
+  write_stream.close();
+
+  /* Replace the file, falling back for systems that won't rename over it */
+  if(success)
+    success = !std::rename(file_name_temp.c_str(), filename.c_str()) ||
+              fileRename(file_name_temp, filename, true);
+  else
+    fileDelete(file_name_temp);
+
+  return success;
+}
@@ -15,6 +15,11 @@ const float Frame::kGREY_FOR_BLUE = 0.07;
 const float Frame::kGREY_FOR_GREEN = 0.71;
 const float Frame::kGREY_FOR_RED = 0.21;
 
+/* Static Implementation - see header file for descriptions */
+std::vector<SDL_Rect> Frame::batch_rects;
+uint16_t Frame::batch_depth = 0;
+std::map<std::string, std::weak_ptr<SDL_Texture>> Frame::grey_cache;
+
 /*=============================================================================
  * CONSTRUCTORS / DESTRUCTORS
  *============================================================================*/
@@ -29,9 +34,12 @@ const float Frame::kGREY_FOR_RED = 0.21;
 Frame::Frame()
 {
   alpha = kDEFAULT_ALPHA;
+  angle = 0;
   color_alpha = 0;
   color_mode = ColorMode::COLOR;
   flip = SDL_FLIP_NONE;
+  grey_enabled = false;
+  grey_renderer = nullptr;
   height = 0;
   next = nullptr;
   path = "";
@@ -92,6 +100,63 @@ Frame::~Frame()
   unsetTexture();
 }
 
+/*=============================================================================
+ * PRIVATE FUNCTIONS
+ *============================================================================*/
+
+/*
+ * Description: Creates the greyscale texture of the loaded image, if enabled
+ *              and not yet created. Frames that loaded the same image at the
+ *              same angle share the one texture, so it is only converted for
+ *              the first of them.
+ *
+ * Inputs: none
+ * Output: bool - true if the greyscale texture is set
+ */
+bool Frame::createGrey()
+{
+  if(texture_grey == nullptr && grey_enabled)
+  {
+    std::string key = path + "@" + std::to_string(angle);
+    std::shared_ptr<SDL_Texture> shared = grey_cache[key].lock();
+
+    /* Not shared by any other frame - convert the image */
+    if(shared == nullptr)
+    {
+      SDL_Surface* surface = loadSurface(path, angle);
+      if(surface != nullptr)
+      {
+        if(surface->format->BytesPerPixel == 4)
+        {
+          greyPixels(surface);
+          SDL_Texture* created =
+              SDL_CreateTextureFromSurface(grey_renderer, surface);
+          if(created != nullptr)
+          {
+            shared.reset(created, SDL_DestroyTexture);
+            grey_cache[key] = shared;
+          }
+        }
+        SDL_FreeSurface(surface);
+      }
+    }
+
+    /* Set it, or stop trying if it could not be created */
+    if(shared != nullptr)
+    {
+      texture_grey = shared;
+      SDL_SetTextureAlphaMod(texture_grey.get(), alpha);
+    }
+    else
+    {
+      grey_cache.erase(key);
+      grey_enabled = false;
+    }
+  }
+
+  return (texture_grey != nullptr);
+}
+
 /*=============================================================================
  * PUBLIC FUNCTIONS
  *============================================================================*/
@@ -276,7 +341,10 @@ Frame* Frame::getPrevious()
 SDL_Texture* Frame::getTexture(bool grey_scale)
 {
   if(grey_scale)
-    return texture_grey;
+  {
+    createGrey();
+    return texture_grey.get();
+  }
   return texture;
 }
 
@@ -293,7 +361,7 @@ SDL_Texture* Frame::getTexture(bool grey_scale)
 SDL_Texture* Frame::getTextureActive()
 {
   if(color_mode == ColorMode::GREY || color_mode == ColorMode::GREYING)
-    return texture_grey;
+    return getTexture(true);
   return texture;
 }
 
@@ -310,7 +378,8 @@ int Frame::getWidth()
 }
 
 /*
- * Description: Returns if a texture is stored in this frame
+ * Description: Returns if a texture is stored in this frame. The grey scale
+ *              texture counts as set if it can be created on first use.
  *
  * Inputs: bool grey_scale - set to true to check the grey scale texture
  * Output: bool - Status if an image is actually set
@@ -318,7 +387,7 @@ int Frame::getWidth()
 bool Frame::isTextureSet(bool grey_scale)
 {
   if(grey_scale)
-    return (texture_grey != nullptr);
+    return (texture_grey != nullptr || (grey_enabled && texture != nullptr));
   return (texture != nullptr);
 }
 
@@ -353,11 +422,16 @@ bool Frame::render(SDL_Renderer* renderer, int x, int y, int w, int h,
     if(w > 0)
       rect.w = w;
 
+    /* The greyscale texture, created if this is the first grey render */
+    SDL_Texture* grey = nullptr;
+    if(color_mode != ColorMode::COLOR)
+      grey = getTexture(true);
+
     /* Render and return status - based on status */
     /* -- GREYING : color bottom, grey top -- */
     if(color_mode == ColorMode::GREYING && color_alpha < alpha)
     {
-      if(texture != nullptr && texture_grey != nullptr)
+      if(texture != nullptr && grey != nullptr)
       {
         bool success = true;
 
@@ -371,9 +445,9 @@ bool Frame::render(SDL_Renderer* renderer, int x, int y, int w, int h,
                                      nullptr, flip) == 0);
 
         /* Grey */
-        SDL_SetTextureBlendMode(texture_grey, SDL_BLENDMODE_BLEND);
-        SDL_SetTextureAlphaMod(texture_grey, color_alpha);
-        success &= (SDL_RenderCopyEx(renderer, texture_grey, src_rect, &rect, 0,
+        SDL_SetTextureBlendMode(grey, SDL_BLENDMODE_BLEND);
+        SDL_SetTextureAlphaMod(grey, color_alpha);
+        success &= (SDL_RenderCopyEx(renderer, grey, src_rect, &rect, 0,
                                      nullptr, flip) == 0);
 
         setAlpha(this->alpha);
@@ -383,17 +457,17 @@ bool Frame::render(SDL_Renderer* renderer, int x, int y, int w, int h,
     /* -- COLORING : grey bottom, color top -- */
     else if(color_mode == ColorMode::COLORING && color_alpha < alpha)
     {
-      if(texture != nullptr && texture_grey != nullptr)
+      if(texture != nullptr && grey != nullptr)
       {
         bool success = true;
 
         /* Grey */
         if(for_sprite)
-          SDL_SetTextureBlendMode(texture_grey, SDL_BLENDMODE_NONE);
+          SDL_SetTextureBlendMode(grey, SDL_BLENDMODE_NONE);
         else
-          SDL_SetTextureBlendMode(texture_grey, SDL_BLENDMODE_BLEND);
-        SDL_SetTextureAlphaMod(texture_grey, this->alpha - color_alpha);
-        success &= (SDL_RenderCopyEx(renderer, texture_grey, src_rect, &rect, 0,
+          SDL_SetTextureBlendMode(grey, SDL_BLENDMODE_BLEND);
+        SDL_SetTextureAlphaMod(grey, this->alpha - color_alpha);
+        success &= (SDL_RenderCopyEx(renderer, grey, src_rect, &rect, 0,
                                      nullptr, flip) == 0);
 
         /* Color */
@@ -409,14 +483,15 @@ bool Frame::render(SDL_Renderer* renderer, int x, int y, int w, int h,
     /* -- GREY ONLY (or GREYING if color alpha exceeds class alpha) -- */
     else if(color_mode == ColorMode::GREY || color_mode == ColorMode::GREYING)
     {
-      if(texture_grey != nullptr)
+      if(grey != nullptr)
       {
         if(for_sprite)
-          SDL_SetTextureBlendMode(texture_grey, SDL_BLENDMODE_NONE);
+          SDL_SetTextureBlendMode(grey, SDL_BLENDMODE_NONE);
         else
-          SDL_SetTextureBlendMode(texture_grey, SDL_BLENDMODE_BLEND);
-        return (SDL_RenderCopyEx(renderer, texture_grey, src_rect, &rect, 0,
-                                 nullptr, flip) == 0);
+          SDL_SetTextureBlendMode(grey, SDL_BLENDMODE_BLEND);
+        SDL_SetTextureAlphaMod(grey, alpha);
+        return (SDL_RenderCopyEx(renderer, grey, src_rect, &rect, 0, nullptr,
+                                 flip) == 0);
       }
     }
     /* -- COLOR ONLY (or COLORING if color alpha exceeds class alpha) -- */
@@ -448,7 +523,8 @@ void Frame::setAlpha(uint8_t alpha)
 {
   this->alpha = alpha;
   SDL_SetTextureAlphaMod(texture, alpha);
-  SDL_SetTextureAlphaMod(texture_grey, alpha);
+  if(texture_grey != nullptr)
+    SDL_SetTextureAlphaMod(texture_grey.get(), alpha);
 }
 
 /*
@@ -586,7 +662,7 @@ bool Frame::setTexture(std::string path, SDL_Renderer* renderer, uint16_t angle,
   bool success = true;
 
   /* Attempt to load the image */
-  SDL_Surface* loaded_surface = IMG_Load(path.c_str());
+  SDL_Surface* loaded_surface = loadSurface(path, angle);
 
   /* If successful, unset previous and set the new texture */
   if(loaded_surface != nullptr && renderer != nullptr)
@@ -595,86 +671,19 @@ bool Frame::setTexture(std::string path, SDL_Renderer* renderer, uint16_t angle,
     unsetTexture();
 
     /* Set the path */
+    this->angle = angle;
     this->path = path;
 
-    /* Angle surface modification - only works for %90 angles */
-    if(angle > 0 && loaded_surface->h == loaded_surface->w &&
-       loaded_surface->format->BytesPerPixel == 4)
-    {
-      uint32_t* pixels = static_cast<uint32_t*>(loaded_surface->pixels);
-      std::vector<std::vector<uint32_t>> pixels_original;
-
-      /* Make a copy of the original pixels */
-      for(int i = 0; i < loaded_surface->h; i++)
-      {
-        std::vector<uint32_t> pixels_row;
-
-        for(int j = 0; j < loaded_surface->w; j++)
-          pixels_row.push_back(pixels[i * loaded_surface->w + j]);
-        pixels_original.push_back(pixels_row);
-      }
-
-      /* Shift the pixels */
-      for(uint32_t i = 0; i < pixels_original.size(); i++)
-      {
-        for(uint32_t j = 0; j < pixels_original[i].size(); j++)
-        {
-          int index = 0;
-
-          /* Do the shift, based on which angle to use */
-          if(angle == 90)
-            index = j * loaded_surface->w + (loaded_surface->h - i - 1);
-          else if(angle == 180)
-            index = (loaded_surface->w - i - 1) * loaded_surface->w +
-                    (loaded_surface->h - j - 1);
-          else if(angle == 270)
-            index = (loaded_surface->w - j - 1) * loaded_surface->w + i;
-
-          pixels[index] = pixels_original[i][j];
-        }
-      }
-    }
-
     /* Create the texture from the surface */
     texture = SDL_CreateTextureFromSurface(renderer, loaded_surface);
     height = loaded_surface->h;
     width = loaded_surface->w;
 
-    /* Create the greyscale texture, if applicable */
+    /* The greyscale texture is only created once it is first needed */
     if(enable_greyscale && loaded_surface->format->BytesPerPixel == 4)
     {
-      SDL_Surface* grey_surface =
-          SDL_ConvertSurface(loaded_surface, loaded_surface->format, 0);
-
-      /* Change all the pixels to greyscale */
-      uint32_t* grey_pixels = static_cast<uint32_t*>(grey_surface->pixels);
-
-      /* Parse each pixel and modify it's value */
-      for(int i = 0; i < grey_surface->h; i++)
-      {
-        for(int j = 0; j < grey_surface->w; j++)
-        {
-          uint32_t* pixel = &grey_pixels[i * loaded_surface->w + j];
-
-          /* Get the color data */
-          SDL_Color color;
-          SDL_GetRGBA(*pixel, grey_surface->format, &color.r, &color.g,
-                      &color.b, &color.a);
-
-          /* Modify the color data -> to greyscale */
-          color.r = getGreyValue(color.r, color.g, color.b);
-          color.g = color.r;
-          color.b = color.r;
-
-          /* Insert the new color data */
-          *pixel = SDL_MapRGBA(grey_surface->format, color.r, color.g, color.b,
-                               color.a);
-        }
-      }
-
-      /* Create greyscale texture and then clean up */
-      texture_grey = SDL_CreateTextureFromSurface(renderer, grey_surface);
-      SDL_FreeSurface(grey_surface);
+      grey_enabled = true;
+      grey_renderer = renderer;
     }
 
     /* Finally, set the alpha rating */
@@ -778,14 +787,22 @@ void Frame::unsetTexture()
     SDL_DestroyTexture(texture);
   texture = nullptr;
 
-  /* Delete greyscale texture */
+  /* Release greyscale texture - deleted once no other frame shares it */
   if(texture_grey != nullptr)
-    SDL_DestroyTexture(texture_grey);
-  texture_grey = nullptr;
+  {
+    texture_grey = nullptr;
+
+    auto cached = grey_cache.find(path + "@" + std::to_string(angle));
+    if(cached != grey_cache.end() && cached->second.expired())
+      grey_cache.erase(cached);
+  }
 
   /* Clear class parameters */
+  angle = 0;
   color_mode = ColorMode::COLOR;
   color_alpha = 0;
+  grey_enabled = false;
+  grey_renderer = nullptr;
   height = 0;
   path = "";
   width = 0;
@@ -814,7 +831,7 @@ void Frame::drawLine(int32_t x1, int32_t x2, int32_t y, SDL_Renderer* renderer)
   rect.y = y;
   rect.h = 1;
 
-  SDL_RenderFillRect(renderer, &rect);
+  fillRect(rect, renderer);
 }
 
 /*
@@ -836,7 +853,94 @@ void Frame::drawLineY(int32_t y1, int32_t y2, int32_t x, SDL_Renderer* renderer)
   rect.x = x;
   rect.w = 1;
 
-  SDL_RenderFillRect(renderer, &rect);
+  fillRect(rect, renderer);
+}
+
+/*
+ * Description: This draws a single point in SDL. It is a 1x1 fill rect so it
+ *              can join the rect batch with the lines.
+ *
+ * Inputs: int32_t x - the x coordinate
+ *         int32_t y - the y coordinate
+ *         SDL_Renderer* renderer - the rendering pointer
+ * Output: none
+ */
+void Frame::drawPoint(int32_t x, int32_t y, SDL_Renderer* renderer)
+{
+  SDL_Rect rect;
+  rect.x = x;
+  rect.y = y;
+  rect.w = 1;
+  rect.h = 1;
+
+  fillRect(rect, renderer);
+}
+
+/*
+ * Description: Fills the rect with the current draw color. If a rect batch is
+ *              open, the rect is deferred until the batch is closed instead.
+ *
+ * Inputs: const SDL_Rect& rect - the rect to fill
+ *         SDL_Renderer* renderer - the rendering pointer
+ * Output: none
+ */
+void Frame::fillRect(const SDL_Rect& rect, SDL_Renderer* renderer)
+{
+  if(batch_depth > 0)
+    batch_rects.push_back(rect);
+  else
+    SDL_RenderFillRect(renderer, &rect);
+}
+
+/*
+ * Description: Converts all the 32 bit pixels of the surface to greyscale, in
+ *              place. One flat pass over the raw pixels with integer weights
+ *              and the format masks, in place of a get and map per pixel.
+ *
+ * Inputs: SDL_Surface* surface - the 32 bit surface to convert
+ * Output: none
+ */
+void Frame::greyPixels(SDL_Surface* surface)
+{
+  const SDL_PixelFormat* format = surface->format;
+  const uint32_t red = static_cast<uint32_t>(kGREY_FOR_RED * 256 + 0.5);
+  const uint32_t green = static_cast<uint32_t>(kGREY_FOR_GREEN * 256 + 0.5);
+  const uint32_t blue = static_cast<uint32_t>(kGREY_FOR_BLUE * 256 + 0.5);
+  const uint32_t count = surface->pitch / 4 * surface->h;
+  uint32_t* pixels = static_cast<uint32_t*>(surface->pixels);
+
+  for(uint32_t i = 0; i < count; i++)
+  {
+    uint32_t pixel = pixels[i];
+    uint32_t grey = (((pixel & format->Rmask) >> format->Rshift) * red +
+                     ((pixel & format->Gmask) >> format->Gshift) * green +
+                     ((pixel & format->Bmask) >> format->Bshift) * blue) >>
+                    8;
+
+    pixels[i] = (pixel & format->Amask) | (grey << format->Rshift) |
+                (grey << format->Gshift) | (grey << format->Bshift);
+  }
+}
+
+/*
+ * Description: Loads the image at the path and rotates it by the angle. The
+ *              rotation only applies to square 32 bit images, at mod 90.
+ *
+ * Inputs: const std::string& path - the path to the image
+ *         uint16_t angle - the angle to rotate by
+ * Output: SDL_Surface* - the loaded surface. NULL if the load failed
+ */
+SDL_Surface* Frame::loadSurface(const std::string& path, uint16_t angle)
+{
+  SDL_Surface* surface = AssetPack::loadImage(path);
+
+  if(surface != nullptr && angle > 0 && surface->h == surface->w &&
+     surface->format->BytesPerPixel == 4)
+  {
+    rotatePixels(surface, angle);
+  }
+
+  return surface;
 }
 
 /*
@@ -1028,10 +1132,101 @@ void Frame::renderTopFlatTriangle(uint16_t x1, uint16_t x2, uint16_t x3,
   }
 }
 
+/*
+ * Description: Rotates the pixels of the square 32 bit surface by the angle
+ *              (90, 180 or 270). Each source pixel is written straight to its
+ *              rotated index in one pass and the result copied back by row.
+ *
+ * Inputs: SDL_Surface* surface - the square 32 bit surface to rotate
+ *         uint16_t angle - the angle to rotate by
+ * Output: none
+ */
+void Frame::rotatePixels(SDL_Surface* surface, uint16_t angle)
+{
+  const int size = surface->w;
+  const int stride = surface->pitch / 4;
+  uint32_t* pixels = static_cast<uint32_t*>(surface->pixels);
+
+  /* The destination index is base + row * step_row + column * step_col */
+  int base = 0;
+  int step_col = 0;
+  int step_row = 0;
+  if(angle == 90)
+  {
+    base = size - 1;
+    step_col = size;
+    step_row = -1;
+  }
+  else if(angle == 180)
+  {
+    base = size * size - 1;
+    step_col = -1;
+    step_row = -size;
+  }
+  else if(angle == 270)
+  {
+    base = (size - 1) * size;
+    step_col = -size;
+    step_row = 1;
+  }
+  else
+  {
+    return;
+  }
+
+  /* Shift the pixels */
+  std::vector<uint32_t> rotated(size * size);
+  for(int i = 0; i < size; i++)
+  {
+    const uint32_t* row = &pixels[i * stride];
+    int index = base + i * step_row;
+
+    for(int j = 0; j < size; j++, index += step_col)
+      rotated[index] = row[j];
+  }
+
+  for(int i = 0; i < size; i++)
+    memcpy(&pixels[i * stride], &rotated[i * size], size * sizeof(uint32_t));
+}
+
 /*=============================================================================
  * PUBLIC STATIC FUNCTIONS
  *============================================================================*/
 
+/*
+ * Description: Opens a rect batch. Until the matching batchEnd(), all lines
+ *              and points of the single color primitives are collected and
+ *              then filled in one draw call. The draw color must not change
+ *              while a batch is open.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void Frame::batchBegin()
+{
+  batch_depth++;
+}
+
+/*
+ * Description: Closes a rect batch. When the outermost batch is closed, all
+ *              collected rects are filled with the current draw color.
+ *
+ * Inputs: SDL_Renderer* renderer - the rendering pointer
+ * Output: none
+ */
+void Frame::batchEnd(SDL_Renderer* renderer)
+{
+  if(batch_depth > 0)
+    batch_depth--;
+
+  if(batch_depth == 0 && !batch_rects.empty())
+  {
+    if(renderer != nullptr)
+      SDL_RenderFillRects(renderer, batch_rects.data(), batch_rects.size());
+    batch_rects.clear();
+  }
+}
+
 /*
  * Description: Takes a series of coordinates and draws the line between all.
  *
@@ -1043,8 +1238,10 @@ void Frame::renderTopFlatTriangle(uint16_t x1, uint16_t x2, uint16_t x3,
 void Frame::drawLine(std::vector<Coordinate> line_points,
                      SDL_Renderer* renderer)
 {
+  batchBegin();
   for(auto& point : line_points)
-    SDL_RenderDrawPoint(renderer, point.x, point.y);
+    drawPoint(point.x, point.y, renderer);
+  batchEnd(renderer);
 }
 
 /*
@@ -1080,15 +1277,17 @@ bool Frame::renderBar(uint16_t x, uint16_t y, uint16_t length, uint16_t height,
   /* Prechecks */
   if(renderer != nullptr && length > 0 && height > 0)
   {
+    batchBegin();
     for(uint16_t i = 0; i < height; i++)
     {
       uint16_t modified_x = x - i * slope;
       if(length == 1)
-        SDL_RenderDrawPoint(renderer, modified_x, y);
+        drawPoint(modified_x, y, renderer);
       else
         Frame::drawLine(modified_x, modified_x + length, y, renderer);
       y++;
     }
+    batchEnd(renderer);
     return true;
   }
   return false;
@@ -1117,16 +1316,17 @@ bool Frame::renderCircle(int center_x, int center_y, uint16_t radius,
     int e = -radius;
 
     /* Render end center points */
+    batchBegin();
     if(radius == 0)
     {
-      SDL_RenderDrawPoint(renderer, x0, y0);
+      drawPoint(x0, y0, renderer);
     }
     else
     {
-      SDL_RenderDrawPoint(renderer, x0 + radius, y0);
-      SDL_RenderDrawPoint(renderer, x0 - radius, y0);
-      SDL_RenderDrawPoint(renderer, x0, y0 + radius);
-      SDL_RenderDrawPoint(renderer, x0, y0 - radius);
+      drawPoint(x0 + radius, y0, renderer);
+      drawPoint(x0 - radius, y0, renderer);
+      drawPoint(x0, y0 + radius, renderer);
+      drawPoint(x0, y0 - radius, renderer);
     }
 
     /* Render remaining quadrants */
@@ -1139,30 +1339,30 @@ bool Frame::renderCircle(int center_x, int center_y, uint16_t radius,
         int x2 = y + x0;
         int y1 = y + y0;
         int y2 = x + y0;
-        SDL_RenderDrawPoint(renderer, x1, y1);
+        drawPoint(x1, y1, renderer);
         if(x1 != x2 || y1 != y2)
-          SDL_RenderDrawPoint(renderer, x2, y2);
+          drawPoint(x2, y2, renderer);
 
         /* Bottom Left Quadrant */
         x1 = -x + x0;
         x2 = -y + x0;
-        SDL_RenderDrawPoint(renderer, x1, y1);
+        drawPoint(x1, y1, renderer);
         if(x1 != x2 || y1 != y2)
-          SDL_RenderDrawPoint(renderer, x2, y2);
+          drawPoint(x2, y2, renderer);
 
         /* Top Left Quadrant */
         y1 = -y + y0;
         y2 = -x + y0;
-        SDL_RenderDrawPoint(renderer, x1, y1);
+        drawPoint(x1, y1, renderer);
         if(x1 != x2 || y1 != y2)
-          SDL_RenderDrawPoint(renderer, x2, y2);
+          drawPoint(x2, y2, renderer);
 
         /* Top Right Quadrant */
         x1 = x + x0;
         x2 = y + x0;
-        SDL_RenderDrawPoint(renderer, x1, y1);
+        drawPoint(x1, y1, renderer);
         if(x1 != x2 || y1 != y2)
-          SDL_RenderDrawPoint(renderer, x2, y2);
+          drawPoint(x2, y2, renderer);
       }
 
       /* Increment the counter */
@@ -1175,6 +1375,7 @@ bool Frame::renderCircle(int center_x, int center_y, uint16_t radius,
       }
     }
 
+    batchEnd(renderer);
     return true;
   }
 
@@ -1205,7 +1406,8 @@ bool Frame::renderCircleFilled(int center_x, int center_y, uint16_t radius,
     int delta = -radius;
 
     /* Render end center points */
-    SDL_RenderDrawPoint(renderer, x0, y0);
+    batchBegin();
+    drawPoint(x0, y0, renderer);
     if(radius > 0)
     {
       Frame::drawLine(x0 + 1, x0 + radius + 1, y0, renderer);  /* R */
@@ -1230,7 +1432,7 @@ bool Frame::renderCircleFilled(int center_x, int center_y, uint16_t radius,
           if(x_changed)
             Frame::drawLine(x0 + 1, x2 + 1, y2, renderer);
           else
-            SDL_RenderDrawPoint(renderer, x2, y2);
+            drawPoint(x2, y2, renderer);
         }
 
         /* Bottom Left Quadrant */
@@ -1242,7 +1444,7 @@ bool Frame::renderCircleFilled(int center_x, int center_y, uint16_t radius,
           if(x_changed)
             Frame::drawLine(x2, x0, y2, renderer);
           else
-            SDL_RenderDrawPoint(renderer, x2, y2);
+            drawPoint(x2, y2, renderer);
         }
 
         /* Top Left Quadrant */
@@ -1254,7 +1456,7 @@ bool Frame::renderCircleFilled(int center_x, int center_y, uint16_t radius,
           if(x_changed)
             Frame::drawLine(x2, x0, y2, renderer);
           else
-            SDL_RenderDrawPoint(renderer, x2, y2);
+            drawPoint(x2, y2, renderer);
         }
 
         /* Top Right Quadrant */
@@ -1266,7 +1468,7 @@ bool Frame::renderCircleFilled(int center_x, int center_y, uint16_t radius,
           if(x_changed)
             Frame::drawLine(x0 + 1, x2 + 1, y2, renderer);
           else
-            SDL_RenderDrawPoint(renderer, x2, y2);
+            drawPoint(x2, y2, renderer);
         }
       }
 
@@ -1282,6 +1484,7 @@ bool Frame::renderCircleFilled(int center_x, int center_y, uint16_t radius,
       }
     }
 
+    batchEnd(renderer);
     return true;
   }
 
@@ -1304,10 +1507,23 @@ bool Frame::renderRect(SDL_Rect rect, uint16_t border_width,
 {
   if(renderer != nullptr)
   {
-    /* Render the multiple border rects */
+    /* Render the multiple border rects, each as four edge fills */
+    batchBegin();
     while(border_width > 0 && rect.w >= 0 && rect.h >= 0)
     {
-      SDL_RenderDrawRect(renderer, &rect);
+      if(rect.w > 0 && rect.h > 0)
+      {
+        fillRect({rect.x, rect.y, rect.w, 1}, renderer);
+        if(rect.h > 1)
+          fillRect({rect.x, rect.y + rect.h - 1, rect.w, 1}, renderer);
+        if(rect.h > 2)
+        {
+          fillRect({rect.x, rect.y + 1, 1, rect.h - 2}, renderer);
+          if(rect.w > 1)
+            fillRect({rect.x + rect.w - 1, rect.y + 1, 1, rect.h - 2},
+                     renderer);
+        }
+      }
 
       if(reverse)
       {
@@ -1326,6 +1542,7 @@ bool Frame::renderRect(SDL_Rect rect, uint16_t border_width,
 
       border_width--;
     }
+    batchEnd(renderer);
 
     return true;
   }
@@ -1505,6 +1722,7 @@ bool Frame::renderFillLineToLine(std::vector<Coordinate> start,
   if(start.size() == 0 || end.size() == 0)
     return false;
 
+  batchBegin();
   if(!vertical)
   {
     for(size_t i = 0; i < start.size() && i < end.size(); i++)
@@ -1517,8 +1735,9 @@ bool Frame::renderFillLineToLine(std::vector<Coordinate> start,
       if(start.at(i).x == end.at(i).x)
         Frame::drawLineY(start.at(i).y, end.at(i).y, end.at(i).x, renderer);
 
-    SDL_RenderDrawPoint(renderer, end.back().x, end.back().y);
+    drawPoint(end.back().x, end.back().y, renderer);
   }
+  batchEnd(renderer);
 
   return true;
 }
@@ -16,6 +16,7 @@
 #include "Game/Player/Person.h"
 #include "Game/Battle/AIModule.h"
 #include "Game/Battle/BattleActor.h"
+#include "Logger.h"
 
 /*=============================================================================
  * CONSTANTS
@@ -219,13 +220,13 @@ bool AIModule::buildUniformItems()
       }
       else
       {
-        std::cerr << "[Error]: Null skill use for item ptr" << std::endl;
+        LOG_ERROR(AI, "Null skill use for item ptr");
         error_occured = true;
       }
     }
     else
     {
-      std::cerr << "[Error]: Null item ptr" << std::endl;
+      LOG_ERROR(AI, "Null item ptr");
       error_occured = true;
     }
   }
@@ -334,18 +335,13 @@ void AIModule::calculateActionTypeChances()
     auto it = Helpers::selectNormalizedPair(ra_flt, it_beg, it_end);
 
 /*  Assign the chosen action type */
-#ifdef UDEBUG
-    std::cout << "AIModule Chosen Action Type: "
-              << Helpers::actionTypeToStr((*it).first) << std::endl;
-#endif
+    LOG_DEBUG(AI, "AIModule Chosen Action Type: "
+                      << Helpers::actionTypeToStr((*it).first));
     chosen_action_type = (*it).first;
   }
   else
   {
-#ifdef UDEBUG
-    std::cout << "[Warning] Enemy has no valid action types available."
-              << std::endl;
-#endif
+    LOG_WARNING(AI, "Enemy has no valid action types available.");
   }
 
   /* Set flag so Battle knows that the action type has been chosen */
@@ -499,10 +495,10 @@ bool AIModule::selectRandomAction()
   {
     auto skills_size = valid_skills.size();
 
-    std::cout << "Skills Size: " << skills_size << std::endl;
+    LOG_DEBUG(AI, "Skills Size: " << skills_size);
     auto rand_value = Helpers::randU(1, skills_size);
 
-    std::cout << "Random index value: " << rand_value - 1 << std::endl;
+    LOG_DEBUG(AI, "Random index value: " << rand_value - 1);
 
     chosen_battle_skill = valid_skills.at(rand_value - 1);
     chosen_skill = valid_skills.at(rand_value - 1)->skill;
@@ -529,9 +525,7 @@ bool AIModule::selectRandomAction()
   }
   else
   {
-#ifdef UDEBUG
-    std::cout << "[Error]: Invalid Action type chosen by enemy." << std::endl;
-#endif
+    LOG_ERROR(AI, "Invalid Action type chosen by enemy.");
   }
 
   if(action_index_selected)
@@ -542,7 +536,7 @@ bool AIModule::selectRandomAction()
 
 bool AIModule::selectRandomTargets()
 {
-  std::cout << "Selecting random targets" << std::endl;
+  LOG_DEBUG(AI, "Selecting random targets");
   std::vector<BattleActor*> targets{};
 
   if(chosen_action_type == ActionType::SKILL && chosen_skill)
@@ -656,9 +650,7 @@ bool AIModule::selectPriorityAction()
   }
   else
   {
-#ifdef UDEBUG
-    std::cout << "[Error]: Invalid Action type chosen by enemy." << std::endl;
-#endif
+    LOG_ERROR(AI, "Invalid Action type chosen by enemy.");
   }
 
   if(action_index_selected)
@@ -14,6 +14,7 @@
 ******************************************************************************/
 #include "Game/Battle/Battle.h"
 #include "Game/Battle/RenderElement.h"
+#include "Logger.h"
 
 /*=============================================================================
  * CONSTANTS - Battle Operations
@@ -117,9 +118,11 @@ Battle::Battle()
       delay_curr{0},
       delay_next{0},
       event{nullptr},
+      event_store{nullptr},
       eh{nullptr},
       flags_combat{static_cast<CombatState>(0)},
       flags_render{static_cast<RenderState>(0)},
+      frame_digits{nullptr},
       frame_enemy_backdrop{nullptr},
       music_id{static_cast<int>(Sound::kID_MUSIC_BATTLE)},
       party_allies{nullptr},
@@ -133,9 +136,10 @@ Battle::Battle()
       upkeep_ailment{nullptr},
       victory_screen{nullptr}
 {
-  /* Create a new action buffer and a menu object */
+  /* Create a new action buffer, event and a menu object */
   battle_buffer = new Buffer();
   battle_menu = new BattleMenu();
+  event_store = new BattleEvent();
 }
 
 /*
@@ -146,7 +150,9 @@ Battle::~Battle()
 {
   clearBattleActors();
   clearBackground();
+  clearDigits();
   clearElements();
+  clearElementsPooled();
   clearEnemyBackdrop();
   clearEvent();
   clearLays();
@@ -155,6 +161,10 @@ Battle::~Battle()
     delete battle_buffer;
   battle_buffer = nullptr;
 
+  if(event_store)
+    delete event_store;
+  event_store = nullptr;
+
   if(battle_menu)
     delete battle_menu;
   battle_menu = nullptr;
@@ -181,7 +191,7 @@ void Battle::actionStateSlideIn()
 
   /* Create the fading-in action text */
   auto action_font = config->getFontTTF(FontName::BATTLE_ACTION);
-  auto element = new RenderElement(renderer, action_font);
+  auto element = createElement(action_font);
 
   std::string action_string;
 
@@ -516,19 +526,35 @@ void Battle::checkIfOutcome()
 
 void Battle::clearEvent()
 {
-  if(event)
-    delete event;
-
+  /* The event object is kept in the store, for the next action */
   event = nullptr;
 }
 
+RenderElement* Battle::createElement(TTF_Font* font)
+{
+  RenderElement* element = nullptr;
+
+  if(render_pool.size() > 0)
+  {
+    element = render_pool.back();
+    render_pool.pop_back();
+    element->reset(renderer, font);
+  }
+  else
+  {
+    element = new RenderElement(renderer, font);
+  }
+
+  return element;
+}
+
 void Battle::createDamageElement(BattleActor* actor, DamageType damage_type,
                                  uint32_t amount)
 {
   if(actor && config)
   {
     auto font = config->getFontTTF(FontName::BATTLE_DAMAGE);
-    auto element = new RenderElement(renderer, font);
+    auto element = createElement(font);
 
     element->createAsDamageValue(amount, damage_type, config->getScreenHeight(),
                                  getActorX(actor), getActorY(actor));
@@ -615,11 +641,9 @@ void Battle::loadBattleEvent()
   auto targets = battle_buffer->getTargets();
 
   /* Log the action type and user */
-  if(eh)
-  {
-    eh->log("Action Type: " + Helpers::actionTypeToStr(action_type));
-    eh->log("User: " + battle_buffer->getUser()->getBasePerson()->getName());
-  }
+  LOG_DEBUG(BATTLE, "Action Type: " << Helpers::actionTypeToStr(action_type));
+  LOG_DEBUG(BATTLE,
+            "User: " << battle_buffer->getUser()->getBasePerson()->getName());
 
   auto to_build = (action_type != ActionType::NONE);
   to_build &= (user != nullptr);
@@ -627,9 +651,15 @@ void Battle::loadBattleEvent()
   if(to_build)
   {
     if(action_type == ActionType::SKILL || action_type == ActionType::ITEM)
-      event = new BattleEvent(action_type, user, targets);
+    {
+      event_store->reset(action_type, user, targets);
+      event = event_store;
+    }
     else if(action_type == ActionType::PASS)
-      event = new BattleEvent(action_type, user);
+    {
+      event_store->reset(action_type, user);
+      event = event_store;
+    }
 
     if(action_type == ActionType::SKILL)
       event->event_skill = battle_buffer->getSkill();
@@ -685,7 +715,7 @@ bool Battle::loadMenuForActor(BattleActor* actor)
 void Battle::outcomeStateActionMiss(ActorOutcome& outcome)
 {
   auto damage_font = config->getFontTTF(FontName::BATTLE_DAMAGE);
-  auto element = new RenderElement(renderer, damage_font);
+  auto element = createElement(damage_font);
 
   // TODO: Get miss text to actually render
   element->createAsDamageText(
@@ -727,8 +757,9 @@ void Battle::outcomeStatePlep(ActorOutcome& outcome)
         animation->loadData(renderer);
         delay_amount += animation->getSize() * animation->getAnimationTime();
 
-        render_elements.push_back(
-            new RenderElement(renderer, animation, 1, {x, y}));
+        auto element = createElement();
+        element->createAsPlep(animation, 1, {x, y});
+        render_elements.push_back(element);
       }
     }
   }
@@ -759,7 +790,7 @@ void Battle::outcomeStatePlep(ActorOutcome& outcome)
 void Battle::outcomeStateDamageValue(ActorOutcome& outcome)
 {
   auto damage_font = config->getFontTTF(FontName::BATTLE_DAMAGE);
-  auto element = new RenderElement(renderer, damage_font);
+  auto element = createElement(damage_font);
 
   if(event->getCurrAction())
   {
@@ -839,7 +870,7 @@ void Battle::outcomeStateInflictFlash(ActorOutcome& outcome)
   {
     // TODO: Factor this out
     auto damage_font = config->getFontTTF(FontName::BATTLE_DAMAGE);
-    auto element = new RenderElement(renderer, damage_font);
+    auto element = createElement(damage_font);
 
     element->createAsDamageText(
         "Immune", DamageType::IMMUNE, config->getScreenHeight(),
@@ -851,7 +882,7 @@ void Battle::outcomeStateInflictFlash(ActorOutcome& outcome)
   {
     // TODO: Factor this out
     auto damage_font = config->getFontTTF(FontName::BATTLE_DAMAGE);
-    auto element = new RenderElement(renderer, damage_font);
+    auto element = createElement(damage_font);
 
     element->createAsDamageText(
         "Fizzle", DamageType::ALREADY_INFLICTED, config->getScreenHeight(),
@@ -1134,7 +1165,7 @@ void Battle::updateEnemySelection()
 void Battle::updateFadeInText()
 {
   auto font = config->getFontTTF(FontName::BATTLE_TURN);
-  auto element = new RenderElement(renderer, font);
+  auto element = createElement(font);
 
   std::string turn_text = "";
   uint32_t random = Helpers::randU(1, 55);
@@ -1170,7 +1201,7 @@ void Battle::updateOutcome(int32_t cycle_time)
         {
           auto header_font =
               config->getFontTTF(FontName::BATTLE_VICTORY_HEADER);
-          auto header_text = new RenderElement(renderer, header_font);
+          auto header_text = createElement(header_font);
           header_text->createAsVictoryText("VICTORIOUS",
                                            config->getScreenHeight(),
                                            config->getScreenWidth());
@@ -1194,7 +1225,7 @@ void Battle::updateOutcome(int32_t cycle_time)
       victory_screen->buildVictory();
 
       /* Dim the Battle a little - infinite render element */
-      auto dim_element = new RenderElement();
+      auto dim_element = createElement();
       auto dim_time = 1500;
 
       dim_element->createAsRGBOverlay({0, 0, 0, 150}, dim_time, dim_time,
@@ -1218,7 +1249,7 @@ void Battle::updatePersonalUpkeep()
     if(getFlagCombat(CombatState::CURR_UPKEEP_DONE) ||
        state == UpkeepState::COMPLETE)
     {
-      std::cout << "Unsettinge upkeep actor" << std::endl;
+      LOG_DEBUG(BATTLE, "Unsettinge upkeep actor");
       setFlagCombat(CombatState::CURR_UPKEEP_DONE, false);
       upkeep_actor = nullptr;
     }
@@ -1234,8 +1265,8 @@ void Battle::updatePersonalUpkeep()
     upkeep_actor = getNextUpkeepActor();
 
     if(upkeep_actor)
-      std::cout << "Next Upkeep Actor: "
-                << upkeep_actor->getBasePerson()->getName() << std::endl;
+      LOG_DEBUG(BATTLE, "Next Upkeep Actor: "
+                            << upkeep_actor->getBasePerson()->getName());
 
     if(!upkeep_actor)
       setFlagCombat(CombatState::PHASE_DONE, true);
@@ -1254,7 +1285,7 @@ void Battle::updatePersonalVitaRegen()
   {
     upkeep_actor->restoreVita(vita_regen);
     auto font = config->getFontTTF(FontName::BATTLE_DAMAGE);
-    auto element = new RenderElement(renderer, font);
+    auto element = createElement(font);
 
     element->createAsRegenValue(
         vita_regen, DamageType::VITA_REGEN, config->getScreenHeight(),
@@ -1276,7 +1307,7 @@ void Battle::updatePersonalQtdrRegen()
   {
     upkeep_actor->restoreQtdr(qtdr_regen);
     auto font = config->getFontTTF(FontName::BATTLE_DAMAGE);
-    auto element = new RenderElement(renderer, font);
+    auto element = createElement(font);
 
     element->createAsRegenValue(
         qtdr_regen, DamageType::QTDR_REGEN, config->getScreenHeight(),
@@ -1331,7 +1362,7 @@ void Battle::updatePersonalAilments()
 
     if(!upkeep_ailment)
     {
-      std::cout << "Setting upkeep actor state to complete" << std::endl;
+      LOG_DEBUG(BATTLE, "Setting upkeep actor state to complete");
       upkeep_actor->setUpkeepState(UpkeepState::COMPLETE);
     }
     else
@@ -1345,10 +1376,7 @@ void Battle::updateProcessing()
   if(!battle_buffer->isSorted())
   {
     battle_buffer->reorder();
-
-#ifdef UDEBUG
     battle_buffer->print(false);
-#endif
   }
 
   /* Check if the current event is finished processing */
@@ -1379,7 +1407,7 @@ void Battle::updateProcessing()
 
 void Battle::updateScreenDim()
 {
-  auto element = new RenderElement();
+  auto element = createElement();
   element->createAsRGBOverlay({0, 0, 0, 255}, 2500, 0, 2200,
                               config->getScreenHeight(),
                               config->getScreenWidth());
@@ -1708,6 +1736,64 @@ void Battle::buildActionFrame(BattleActor* actor)
   actor->setActionFrameStart(config->getScreenWidth(), end_y);
 }
 
+/* Build the digit strip that damage values are rendered from */
+void Battle::buildDigits()
+{
+  auto font = config->getFontTTF(FontName::BATTLE_DAMAGE);
+  std::vector<Text*> digits;
+  int32_t height = 0;
+  int32_t width = 0;
+
+  clearDigits();
+
+  if(!font || !renderer)
+    return;
+
+  /* Render each digit in white, it is tinted with color mod when rendered */
+  for(char digit = '0'; digit <= '9'; digit++)
+  {
+    Text* t = new Text(font);
+    t->setText(renderer, std::string(1, digit), {255, 255, 255, 255});
+    frame_digits_rects.push_back({width, 0, t->getWidth(), t->getHeight()});
+    width += t->getWidth();
+    height = std::max(height, t->getHeight());
+    digits.push_back(t);
+  }
+
+  /* Create rendering texture */
+  auto orig_target = SDL_GetRenderTarget(renderer);
+  SDL_Texture* texture = nullptr;
+  if(width > 0 && height > 0)
+    texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888,
+                                SDL_TEXTUREACCESS_TARGET, width, height);
+
+  if(texture)
+  {
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    SDL_SetRenderTarget(renderer, texture);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+    SDL_RenderClear(renderer);
+
+    /* Copy the digits without blending so the glyph edges keep their alpha */
+    for(size_t i = 0; i < digits.size(); i++)
+    {
+      SDL_SetTextureBlendMode(digits[i]->getTexture(), SDL_BLENDMODE_NONE);
+      digits[i]->render(renderer, frame_digits_rects[i].x, 0);
+    }
+
+    SDL_SetRenderTarget(renderer, orig_target);
+    frame_digits = new Frame();
+    frame_digits->setTexture(texture);
+  }
+  else
+  {
+    frame_digits_rects.clear();
+  }
+
+  for(auto& digit : digits)
+    delete digit;
+}
+
 void Battle::buildEnemyBackdrop()
 {
   /* Sizing variables */
@@ -1966,6 +2052,52 @@ void Battle::buildInfoEnemy(BattleActor* enemy)
   enemy->setInfoFrame(enemy_info);
 }
 
+/* Composite the info of the actor with its bars and amounts. This is only
+ * redone when the rendered values have changed since the last composite */
+void Battle::buildInfoValues(BattleActor* actor)
+{
+  if(!actor || !actor->getInfoFrame() || !renderer)
+    return;
+
+  auto& stats = actor->getStatsRendered();
+  std::vector<uint32_t> values = {actor->getPCVita(), actor->getPCQtdr(),
+                                  stats.getValue(Attribute::VITA),
+                                  stats.getValue(Attribute::QTDR)};
+  auto frame = actor->getInfoValuesFrame();
+
+  if(frame && actor->getInfoValues() == values)
+    return;
+
+  /* Create the rendering texture, if it does not already exist */
+  auto is_ally = actor->getFlag(ActorState::ALLY);
+  if(!frame)
+  {
+    uint16_t height = is_ally ? kALLY_HEIGHT : kINFO_H;
+    SDL_Texture* texture =
+        SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888,
+                          SDL_TEXTUREACCESS_TARGET, kINFO_W, height);
+    if(!texture)
+      return;
+
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    frame = new Frame();
+    frame->setTexture(texture);
+  }
+
+  auto orig_target = SDL_GetRenderTarget(renderer);
+  SDL_SetRenderTarget(renderer, frame->getTexture());
+  SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+  SDL_RenderClear(renderer);
+
+  if(is_ally)
+    renderAllyInfoValues(actor);
+  else
+    renderEnemyInfoValues(actor);
+
+  SDL_SetRenderTarget(renderer, orig_target);
+  actor->setInfoValuesFrame(frame, values);
+}
+
 void Battle::clearBackground()
 {
   if(background)
@@ -1974,12 +2106,24 @@ void Battle::clearBackground()
   background = nullptr;
 }
 
+void Battle::clearDigits()
+{
+  if(frame_digits)
+    delete frame_digits;
+
+  frame_digits = nullptr;
+  frame_digits_rects.clear();
+}
+
 void Battle::clearElements()
 {
   for(auto& element : render_elements)
   {
     if(element)
-      delete element;
+    {
+      element->reset(nullptr, nullptr);
+      render_pool.push_back(element);
+    }
 
     element = nullptr;
   }
@@ -1987,6 +2131,19 @@ void Battle::clearElements()
   render_elements.clear();
 }
 
+void Battle::clearElementsPooled()
+{
+  for(auto& element : render_pool)
+  {
+    if(element)
+      delete element;
+
+    element = nullptr;
+  }
+
+  render_pool.clear();
+}
+
 void Battle::clearEnemyBackdrop()
 {
   if(frame_enemy_backdrop)
@@ -2016,7 +2173,10 @@ void Battle::clearElementsTimedOut()
                      [&](RenderElement* element) -> bool {
                        if(element)
                        {
-                         return (element->status == RenderStatus::TIMED_OUT);
+                         if(element->status != RenderStatus::TIMED_OUT)
+                           return false;
+                         element->reset(nullptr, nullptr);
+                         render_pool.push_back(element);
                        }
                        return true;
                      }),
@@ -2230,6 +2390,34 @@ bool Battle::renderAllies()
   return success;
 }
 
+/* Render a value from the digit strip, tinted to the given color */
+bool Battle::renderDigits(std::string value, SDL_Color color, uint8_t alpha,
+                          int32_t x, int32_t y)
+{
+  if(!frame_digits || frame_digits_rects.size() != 10)
+    return false;
+
+  auto texture = frame_digits->getTexture();
+  bool success = true;
+
+  SDL_SetTextureColorMod(texture, color.r, color.g, color.b);
+  SDL_SetTextureAlphaMod(texture, alpha);
+
+  for(const auto& digit : value)
+  {
+    if(digit >= '0' && digit <= '9')
+    {
+      auto& src_rect = frame_digits_rects[digit - '0'];
+      SDL_Rect dst_rect = {x, y, src_rect.w, src_rect.h};
+
+      success &= (SDL_RenderCopy(renderer, texture, &src_rect, &dst_rect) == 0);
+      x += src_rect.w;
+    }
+  }
+
+  return success;
+}
+
 bool Battle::renderElements()
 {
   for(auto& element : render_elements)
@@ -2279,21 +2467,49 @@ void Battle::renderElementRGBOverlay(RenderElement* element)
 
 void Battle::renderElementText(RenderElement* element)
 {
-  if(element->element_font)
+  auto point = element->location.point;
+  auto shadow = element->shadow_offset;
+  auto& text = element->text_string;
+
+  /* Damage values are rendered from the digit strip */
+  auto is_value = config && frame_digits && !text.empty() &&
+                  element->element_font ==
+                      config->getFontTTF(FontName::BATTLE_DAMAGE) &&
+                  text.find_first_not_of("0123456789") == std::string::npos;
+
+  if(is_value)
   {
-    Text t(element->element_font);
-    auto point = element->location.point;
-    auto shadow = element->shadow_offset;
+    renderDigits(text, element->color, element->alpha, point.x, point.y);
+
+    if(element->has_shadow)
+    {
+      renderDigits(text, element->shadow_color, element->alpha,
+                   point.x + shadow.x, point.y + shadow.y);
+    }
+  }
+  else if(element->element_font)
+  {
+    /* Other text is rendered once and only has its alpha updated */
+    if(!element->element_text.getTexture())
+    {
+      element->element_text.setFont(element->element_font);
+      element->element_text.setText(renderer, text, element->color);
+    }
 
-    t.setText(renderer, element->text_string, element->color);
-    t.setAlpha(element->alpha);
-    t.render(renderer, point.x, point.y);
+    element->element_text.setAlpha(element->alpha);
+    element->element_text.render(renderer, point.x, point.y);
 
     if(element->has_shadow)
     {
-      t.setText(renderer, element->text_string, element->shadow_color);
-      t.setAlpha(element->alpha);
-      t.render(renderer, point.x + shadow.x, point.y + shadow.y);
+      if(!element->shadow_text.getTexture())
+      {
+        element->shadow_text.setFont(element->element_font);
+        element->shadow_text.setText(renderer, text, element->shadow_color);
+      }
+
+      element->shadow_text.setAlpha(element->alpha);
+      element->shadow_text.render(renderer, point.x + shadow.x,
+                                  point.y + shadow.y);
     }
   }
 }
@@ -2358,42 +2574,53 @@ bool Battle::renderEnemiesInfo()
   {
     bool to_render = enemy && enemy->getInfoFrame() && enemy->getBasePerson();
 
-    if(to_render)
+    if(to_render && frame_enemy_backdrop)
     {
-      /* Calculate health bar amount and color */
       auto x = getActorX(enemy);
 
-      /* Render enemy backdrop */
-      success &= frame_enemy_backdrop->render(renderer, x, y);
+      /* Render the backdrop, health bar and info (updated on change) */
+      buildInfoValues(enemy);
 
-      /* Get the percent of vitality, and set it at least at 1% */
-      auto health_pc = (float)enemy->getPCVita() / 100.0;
-      health_pc = Helpers::setInRange(health_pc, 0.0, 1.0);
+      if(enemy->getInfoValuesFrame())
+        success &= enemy->getInfoValuesFrame()->render(renderer, x, y);
+      else
+        success = false;
 
-      setupHealthDraw(enemy, health_pc);
+      /* Render ailments */
+      renderAilmentsActor(enemy, x + kINFO_W / 2, y, true);
+    }
+  }
 
-      /* Calculate health bar render amount */
-      auto health_am = (kENEMY_BAR_W + kENEMY_BAR_TRIANGLE) * health_pc;
+  return success;
+}
 
-      if(health_am == 0 && health_pc > 0.0)
-        health_am = 1;
-      else if(health_am == (kENEMY_BAR_W + kENEMY_BAR_TRIANGLE) &&
-              health_pc < 1.0)
-        --health_am;
+/* Render the enemy backdrop, health bar and info at the origin */
+bool Battle::renderEnemyInfoValues(BattleActor* enemy)
+{
+  bool success = frame_enemy_backdrop->render(renderer, 0, 0);
 
-      /* Render health bar */
-      Frame::renderBar(x + (kINFO_W - kENEMY_BAR_W) / 2 + 1,
-                       y + (kINFO_H - kENEMY_BAR_H) / 2 + kENEMY_BAR_OFFSET,
-                       health_am, kENEMY_BAR_H,
-                       (float)kENEMY_BAR_TRIANGLE / kENEMY_BAR_H, renderer);
+  /* Get the percent of vitality, and set it at least at 1% */
+  auto health_pc = (float)enemy->getPCVita() / 100.0;
+  health_pc = Helpers::setInRange(health_pc, 0.0, 1.0);
 
-      /* Render foe info */
-      success &= enemy->getInfoFrame()->render(renderer, x, y);
+  setupHealthDraw(enemy, health_pc);
 
-      /* Render ailments */
-      renderAilmentsActor(enemy, x + kINFO_W / 2, y, true);
-    }
-  }
+  /* Calculate health bar render amount */
+  auto health_am = (kENEMY_BAR_W + kENEMY_BAR_TRIANGLE) * health_pc;
+
+  if(health_am == 0 && health_pc > 0.0)
+    health_am = 1;
+  else if(health_am == (kENEMY_BAR_W + kENEMY_BAR_TRIANGLE) && health_pc < 1.0)
+    --health_am;
+
+  /* Render health bar */
+  Frame::renderBar((kINFO_W - kENEMY_BAR_W) / 2 + 1,
+                   (kINFO_H - kENEMY_BAR_H) / 2 + kENEMY_BAR_OFFSET, health_am,
+                   kENEMY_BAR_H, (float)kENEMY_BAR_TRIANGLE / kENEMY_BAR_H,
+                   renderer);
+
+  /* Render foe info */
+  success &= enemy->getInfoFrame()->render(renderer, 0, 0);
 
   return success;
 }
@@ -2460,7 +2687,6 @@ void Battle::renderUnderlays()
 
 bool Battle::renderAllyInfo(BattleActor* ally, bool for_menu)
 {
-  auto font_subheader = config->getFontTTF(FontName::BATTLE_SUBHEADER);
   bool success = true;
 
   auto x = 0;
@@ -2478,14 +2704,51 @@ bool Battle::renderAllyInfo(BattleActor* ally, bool for_menu)
     y = config->getScreenHeight() - kALLY_HEIGHT;
   }
 
+  /* Render the bars and amounts (composited again only on change) */
+  buildInfoValues(ally);
+
+  if(ally->getInfoValuesFrame())
+    success &= ally->getInfoValuesFrame()->render(renderer, x, y);
+  else
+    success = false;
+
+  /* Render ailments */
+  if(for_menu && ally->getAilments().size() > 0)
+  {
+    auto frame = display_data->getFrameAilment(Infliction::SILENCE);
+    auto frame_size = 0;
+
+    if(frame)
+      frame_size = frame->getHeight();
+
+    auto ailment_y =
+        y + kALLY_HEIGHT + kAILMENT_GAP * 2 + kAILMENT_BORDER * 2 + frame_size;
+
+    success &= renderAilmentsActor(ally, x + kINFO_W / 2, ailment_y, true);
+  }
+  else if(!for_menu && ally->getAilments().size() > 0)
+  {
+    auto ailment_y = config->getScreenHeight() - kBIGBAR_OFFSET;
+    success &= renderAilmentsActor(ally, x + (kINFO_W / 2), ailment_y, false);
+  }
+
+  return success;
+}
+
+/* Render the ally bars, info and amounts at the origin */
+bool Battle::renderAllyInfoValues(BattleActor* ally)
+{
+  auto font_subheader = config->getFontTTF(FontName::BATTLE_SUBHEADER);
+  bool success = true;
+
   /* Get the percent of vitality, and set it at least at 1% */
   auto health_pc = (float)ally->getPCVita() / 100.0;
   health_pc = Helpers::setInRange(health_pc, 0.0, 1.0);
 
   setupHealthDraw(ally, health_pc);
 
-  uint16_t health_x = x + (kINFO_W - kALLY_HEALTH_W) / 2;
-  uint16_t health_y = y + (kALLY_HEIGHT - kALLY_HEALTH_H) / 2;
+  uint16_t health_x = (kINFO_W - kALLY_HEALTH_W) / 2;
+  uint16_t health_y = (kALLY_HEIGHT - kALLY_HEALTH_H) / 2;
 
   /* Calculate health bar render amount */
   int health_amount = (kALLY_HEALTH_W + kALLY_HEALTH_TRIANGLE - 1) * health_pc;
@@ -2502,7 +2765,7 @@ bool Battle::renderAllyInfo(BattleActor* ally, bool for_menu)
                        (float)kALLY_HEALTH_TRIANGLE / kALLY_HEALTH_H, renderer);
 
   /* Render friends info */
-  success &= ally->getInfoFrame()->render(renderer, x, y);
+  success &= ally->getInfoFrame()->render(renderer, 0, 0);
 
   /* Calculate qd bar amount and color */
   auto qd_percent = (float)ally->getPCQtdr() / 100.0;
@@ -2556,26 +2819,6 @@ bool Battle::renderAllyInfo(BattleActor* ally, bool for_menu)
   success &= t->render(renderer, qd_x + (kALLY_QD_W - t->getWidth()) / 2, qd_y);
   delete t;
 
-  /* Render ailments */
-  if(for_menu && ally->getAilments().size() > 0)
-  {
-    auto frame = display_data->getFrameAilment(Infliction::SILENCE);
-    auto frame_size = 0;
-
-    if(frame)
-      frame_size = frame->getHeight();
-
-    auto ailment_y =
-        y + kALLY_HEIGHT + kAILMENT_GAP * 2 + kAILMENT_BORDER * 2 + frame_size;
-
-    success &= renderAilmentsActor(ally, x + kINFO_W / 2, ailment_y, true);
-  }
-  else if(!for_menu && ally->getAilments().size() > 0)
-  {
-    auto ailment_y = config->getScreenHeight() - kBIGBAR_OFFSET;
-    success &= renderAilmentsActor(ally, x + (kINFO_W / 2), ailment_y, false);
-  }
-
   return success;
 }
 
@@ -2770,7 +3013,9 @@ void Battle::upkeepAilmentPlep()
     playInflictionSound(type);
     auto x = getActorX(upkeep_actor);
     auto y = getActorY(upkeep_actor);
-    render_elements.push_back(new RenderElement(renderer, plep, 2, {x, y}));
+    auto element = createElement();
+    element->createAsPlep(plep, 2, {x, y});
+    render_elements.push_back(element);
   }
 
   upkeep_ailment->setUpdateStatus(AilmentStatus::COMPLETED);
@@ -2866,8 +3111,9 @@ bool Battle::startBattle(Party* friends, Party* foes)
       buildInfoEnemy(actor);
   }
 
-  /* Construct the enemy backdrop */
+  /* Construct the enemy backdrop and the damage value digits */
   buildEnemyBackdrop();
+  buildDigits();
 
   turn_state = TurnState::BEGIN;
   delay_curr = 0;
@@ -2881,6 +3127,7 @@ void Battle::stopBattle()
   clearEvent();
   clearBattleActors();
   clearBackground();
+  clearDigits();
   clearElements();
   clearEnemyBackdrop();
   clearLays();
@@ -3077,8 +3324,7 @@ void Battle::setNextTurnState()
     turn_state = TurnState::FINISHED;
 
   /* Log the turn state */
-  if(eh)
-    eh->log("[Turn] " + Helpers::turnStateToStr(turn_state));
+  LOG_DEBUG(BATTLE, "[Turn] " << Helpers::turnStateToStr(turn_state));
 }
 
 bool Battle::update(int32_t cycle_time)
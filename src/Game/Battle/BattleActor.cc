@@ -16,6 +16,7 @@
 #include "Game/Battle/BattleStats.h"
 #include "Game/Player/Ailment.h"
 #include "Game/Player/Person.h"
+#include "Logger.h"
 
 /*=============================================================================
  * CONSTANTS
@@ -53,6 +54,7 @@ BattleActor::BattleActor(Person* person_base, int32_t battle_index,
       battle_index{battle_index},
       flags{static_cast<ActorState>(0)},
       frame_info{nullptr},
+      frame_info_values{nullptr},
       menu_index{menu_index},
       person_base{person_base},
       sprite_ally{nullptr},
@@ -136,7 +138,6 @@ void BattleActor::battleSetup(bool is_ally, bool can_run)
 
   // std::cout << "Current stats for: " << getBasePerson()->getName() << std::endl;
   // curr_stats.print();
-  std::cout << std::endl;
 
   stats_actual = BattleStats(curr_stats, curr_stats);
   stats_rendered = BattleStats(curr_stats, curr_stats);
@@ -185,7 +186,7 @@ void BattleActor::clearAilments()
 
 void BattleActor::clearBattleItems()
 {
-  for(auto& battle_item : battle_items)
+  for(auto& battle_item : pool_battle_items)
   {
     if(battle_item)
       delete battle_item;
@@ -193,11 +194,12 @@ void BattleActor::clearBattleItems()
   }
 
   battle_items.clear();
+  pool_battle_items.clear();
 }
 
 void BattleActor::clearBattleSkills()
 {
-  for(auto& battle_skill : battle_skills)
+  for(auto& battle_skill : pool_battle_skills)
   {
     if(battle_skill)
       delete battle_skill;
@@ -205,6 +207,7 @@ void BattleActor::clearBattleSkills()
   }
 
   battle_skills.clear();
+  pool_battle_skills.clear();
 }
 
 void BattleActor::clearActionFrame()
@@ -219,6 +222,11 @@ void BattleActor::clearInfoFrame()
   if(frame_info)
     delete frame_info;
   frame_info = nullptr;
+
+  if(frame_info_values)
+    delete frame_info_values;
+  frame_info_values = nullptr;
+  info_values.clear();
 }
 
 void BattleActor::clearFlashing()
@@ -472,7 +480,9 @@ bool BattleActor::buildBattleItems(Inventory* inv,
                                    std::vector<BattleActor*> a_targets)
 {
   bool success = true;
-  clearBattleItems();
+
+  /* Rebuild into the pooled objects of the previous turns */
+  battle_items.clear();
 
   if(inv && person_base)
   {
@@ -489,12 +499,15 @@ bool BattleActor::buildBattleItems(Inventory* inv,
         {
           auto targets =
               getTargetsFromScope(this, skill->getScope(), a_targets);
-          auto battle_item = new BattleItem();
+
+          if(battle_items.size() == pool_battle_items.size())
+            pool_battle_items.push_back(new BattleItem());
+          auto battle_item = pool_battle_items[battle_items.size()];
 
           battle_item->valid_status = ValidStatus::VALID;
           battle_item->item = item.first;
           battle_item->amount = item.second;
-          battle_item->targets = targets;
+          battle_item->targets.assign(begin(targets), end(targets));
 
           if(item.second == 0)
             battle_item->valid_status = ValidStatus::ZERO_COUNT;
@@ -519,8 +532,8 @@ bool BattleActor::buildBattleSkills(std::vector<BattleActor*> a_targets)
   /* Updates the base person skills */
   person_base->updateBaseSkills();
 
-  /* Clear BattleSkills if they were previously created */
-  clearBattleSkills();
+  /* Rebuild into the pooled objects of the previous turns */
+  battle_skills.clear();
 
   bool success = person_base;
 
@@ -531,15 +544,17 @@ bool BattleActor::buildBattleSkills(std::vector<BattleActor*> a_targets)
 
     for(auto& element : useable_skills)
     {
-      auto battle_skill = new BattleSkill();
-      battle_skill->skill = element.skill;
-
-      if(battle_skill->skill)
+      if(element.skill)
       {
+        if(battle_skills.size() == pool_battle_skills.size())
+          pool_battle_skills.push_back(new BattleSkill());
+        auto battle_skill = pool_battle_skills[battle_skills.size()];
+        battle_skill->skill = element.skill;
+
         auto skill = battle_skill->skill;
         auto targets = getTargetsFromScope(this, skill->getScope(), a_targets);
 
-        battle_skill->targets = targets;
+        battle_skill->targets.assign(begin(targets), end(targets));
         battle_skill->true_cost = getSkillCost(skill);
 
         bool is_valid{!battle_skill->targets.empty()};
@@ -560,11 +575,6 @@ bool BattleActor::buildBattleSkills(std::vector<BattleActor*> a_targets)
 
         battle_skills.push_back(battle_skill);
       }
-      else
-      {
-        delete battle_skill;
-        battle_skill = nullptr;
-      }
     }
   }
 
@@ -584,12 +594,11 @@ bool BattleActor::dealDamage(int32_t damage_amount)
 
   if(curr_vita != curr_base_vita)
   {
-    std::cout << "[WARNING] : Damage to base value with modified curr vita."
-              << std::endl;
+    LOG_WARNING(BATTLE, "Damage to base value with modified curr vita.");
   }
 
-  std::cout << "Dealing " << damage_amount << " damage with " << curr_vita
-            << " current vita." << std::endl;
+  LOG_DEBUG(BATTLE, "Dealing " << damage_amount << " damage with "
+                               << curr_vita << " current vita.");
   if(damage_amount >= (int32_t)curr_vita)
   {
     stats_actual.setBaseValue(Attribute::VITA, 0);
@@ -624,9 +633,9 @@ void BattleActor::restoreVita(int32_t amount)
   auto curr_value = stats_actual.getBaseValue(Attribute::VITA);
   auto max_value = stats_actual.getBaseValue(Attribute::MVIT);
 
-  std::cout << "--- Restoring ---: " << amount << std::endl;
-  std::cout << "----- With current: " << curr_value << std::endl;
-  std::cout << "----- Max value:    " << max_value << std::endl;
+  LOG_DEBUG(BATTLE, "--- Restoring ---: " << amount
+                        << "\n----- With current: " << curr_value
+                        << "\n----- Max value:    " << max_value);
 
   if(amount > 0 && amount + curr_value <= max_value)
     stats_actual.setBaseValue(Attribute::VITA, curr_value + amount);
@@ -926,6 +935,16 @@ Frame* BattleActor::getInfoFrame()
   return frame_info;
 }
 
+Frame* BattleActor::getInfoValuesFrame()
+{
+  return frame_info_values;
+}
+
+const std::vector<uint32_t>& BattleActor::getInfoValues()
+{
+  return info_values;
+}
+
 Sprite* BattleActor::getDialogSprite()
 {
   return sprite_dialog;
@@ -1133,6 +1152,16 @@ void BattleActor::setInfoFrame(Frame* frame_info)
   this->frame_info = frame_info;
 }
 
+void BattleActor::setInfoValuesFrame(Frame* frame_info_values,
+                                     std::vector<uint32_t> info_values)
+{
+  if(this->frame_info_values && this->frame_info_values != frame_info_values)
+    delete this->frame_info_values;
+
+  this->frame_info_values = frame_info_values;
+  this->info_values = info_values;
+}
+
 void BattleActor::setSelectionState(SelectionState state_selection)
 {
   this->state_selection = state_selection;
@@ -13,6 +13,7 @@
 * ----
 *****************************************************************************/
 #include "Game/Battle/BattleEvent.h"
+#include "Logger.h"
 
 /*=============================================================================
  * CONSTANTS
@@ -473,6 +474,40 @@ bool BattleEvent::setNextAction()
   return false;
 }
 
+void BattleEvent::reset(ActionType type, BattleActor* actor)
+{
+  action_index = 0;
+  action_state = ActionState::BEGIN;
+  action_type = type;
+  this->actor = actor;
+
+  /* Clear (not release) the vectors, so their storage is reused */
+  actor_targets.clear();
+  actor_outcomes.clear();
+  temp_targ_stats.clear();
+
+  event_item = nullptr;
+  event_skill = nullptr;
+  event_type = BattleEventType::NONE;
+  flags_ignore = static_cast<IgnoreState>(0);
+  hit_status_action = SkillHitStatus::HIT;
+  hit_status_skill = SkillHitStatus::HIT;
+
+  attr_prio = Attribute::NONE;
+  attr_prid = Attribute::NONE;
+  attr_seco = Attribute::NONE;
+  attr_secd = Attribute::NONE;
+  attr_user = Attribute::NONE;
+  attr_targ = Attribute::NONE;
+}
+
+void BattleEvent::reset(ActionType type, BattleActor* actor,
+                        const std::vector<BattleActor*>& targets)
+{
+  reset(type, actor);
+  actor_targets.assign(begin(targets), end(targets));
+}
+
 // Does the action crit the given BattleActor?
 // TODO: Crit level modifier
 bool BattleEvent::doesActionCrit(BattleActor* curr_target)
@@ -684,7 +719,8 @@ int32_t BattleEvent::calcValPrimAtk(Skill* curr_skill)
   return 0;
 }
 
-int32_t BattleEvent::calcValPrimDef(Skill* curr_skill, BattleStats target_stats)
+int32_t BattleEvent::calcValPrimDef(Skill* curr_skill,
+                                   const BattleStats& target_stats)
 {
   if(!getFlagIgnore(IgnoreState::IGNORE_PRIM_DEF))
   {
@@ -714,7 +750,8 @@ int32_t BattleEvent::calcValSecdAtk(Skill* curr_skill)
   return 0;
 }
 
-int32_t BattleEvent::calcValSecdDef(Skill* curr_skill, BattleStats target_stats)
+int32_t BattleEvent::calcValSecdDef(Skill* curr_skill,
+                                   const BattleStats& target_stats)
 {
   if(!getFlagIgnore(IgnoreState::IGNORE_SECD_DEF))
   {
@@ -737,7 +774,7 @@ int32_t BattleEvent::calcValLuckAtk()
   return temp_user_stats.getValue(Attribute::WILL) * kMANNA_POW_MODIFIER;
 }
 
-int32_t BattleEvent::calcValLuckDef(BattleStats target_stats)
+int32_t BattleEvent::calcValLuckDef(const BattleStats& target_stats)
 {
   if(getFlagIgnore(IgnoreState::IGNORE_LUCK_DEF))
     return 0;
@@ -972,15 +1009,13 @@ int32_t BattleEvent::calcDamage(BattleActor* curr_target, float crit_factor)
 
   base_damage = 0.75 * (attack_power * (1 - defense_modifier));
 
-  // #ifdef UDEBUG
-  //   std::cout << "=========== Damage Calculations ============" << std::endl;
-  //   std::cout << "Base User Pow: " << base_user_pow << std::endl;
-  //   std::cout << "Base User Def: " << base_targ_def << std::endl;
-  //   std::cout << "Attack Mod: " << attack_modifier << std::endl;
-  //   std::cout << "Attack Pow: " << action_power << std::endl;
-  //   std::cout << "Defens Mod: " << defense_modifier << std::endl;
-  //   std::cout << "Bas Damage: " << base_damage << std::endl;
-  // #endif
+  LOG_DEBUG(BATTLE, "=========== Damage Calculations ============"
+                        << "\nBase User Pow: " << base_user_pow
+                        << "\nBase User Def: " << base_targ_def
+                        << "\nAttack Mod: " << attack_modifier
+                        << "\nAttack Pow: " << action_power
+                        << "\nDefens Mod: " << defense_modifier
+                        << "\nBas Damage: " << base_damage);
 
   // TODO[11-03-15] Other guarding state factors
   if(curr_target->getGuardingState() == GuardingState::DEFENDING)
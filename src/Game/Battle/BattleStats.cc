@@ -13,6 +13,7 @@
 ******************************************************************************/
 #include "Game/Battle/BattleStats.h"
 #include "Game/Battle/BattleActor.h"
+#include "Logger.h"
 #include "Game/Player/Ailment.h"
 
 /*=============================================================================
@@ -30,20 +31,18 @@ const uint32_t BattleStats::kMAX_ADDITIVE_MODS{7};
  *
  * Inputs:
  */
-BattleStats::BattleStats(AttributeSet max_attr_set, AttributeSet min_attr_set)
+BattleStats::BattleStats(const AttributeSet& max_attr_set,
+                         const AttributeSet& min_attr_set)
 {
-  /* Add in the AttributeSet by pairing it with corres. Attribute enums */
+  /* Add in the AttributeSet at the index of the corres. Attribute enums */
   for(uint32_t i = 0; i < AttributeSet::getSize(); i++)
-  {
-    Attribute curr_attr = static_cast<Attribute>(i);
-    values.push_back(std::make_pair(curr_attr, min_attr_set.getStat(i)));
-  }
+    values[i] = min_attr_set.getStat(i);
 
   /* Add Battle-only additional attribute values */
-  values.push_back(
-      std::make_pair(Attribute::MVIT, max_attr_set.getStat(Attribute::VITA)));
-  values.push_back(
-      std::make_pair(Attribute::MQTD, max_attr_set.getStat(Attribute::QTDR)));
+  values[static_cast<uint32_t>(Attribute::MVIT)] =
+      max_attr_set.getStat(Attribute::VITA);
+  values[static_cast<uint32_t>(Attribute::MQTD)] =
+      max_attr_set.getStat(Attribute::QTDR);
 }
 
 /*=============================================================================
@@ -126,50 +125,53 @@ bool BattleStats::removeLinked(Ailment* linked_ailment)
 
 void BattleStats::print()
 {
-#ifdef UDEBUG
+  if(!Logger::isEnabled(LogLevel::DEBUG, LogCategory::BATTLE))
+    return;
+
   /* Print out each of the base values */
-  for(const auto& value : values)
+  std::ostringstream text;
+  for(uint32_t i = 0; i < values.size(); i++)
   {
-    if(static_cast<uint8_t>(value.first) < AttributeSet::getSize())
+    auto stat = static_cast<Attribute>(i);
+
+    if(i < AttributeSet::getSize())
     {
-      std::cout << AttributeSet::getName(static_cast<Attribute>(value.first))
-                << ": " << value.second << " --> " << getValue(value.first) << std::endl;
+      text << AttributeSet::getName(stat)
+           << ": " << values[i] << " --> " << getValue(stat) << "\n";
     }
-    else if(value.first == Attribute::MVIT)
-      std::cout << "MVIT: " << value.second << " --> " << getValue(value.first) << std::endl;
-    else if(value.first == Attribute::MQTD)
-      std::cout << "MQTD: " << value.second << " --> " << getValue(value.first) << std::endl;
+    else if(stat == Attribute::MVIT)
+      text << "MVIT: " << values[i] << " --> " << getValue(stat) << "\n";
+    else if(stat == Attribute::MQTD)
+      text << "MQTD: " << values[i] << " --> " << getValue(stat) << "\n";
   }
-
-  std::cout << std::endl;
+  LOG_DEBUG(BATTLE, text.str());
 
   /* Print out the modifiers */
   for(const auto& modifier : modifiers)
   {
+    text.str("");
     if(modifier.type == ModifierType::MULTIPLICATIVE)
-      std::cout << "---- Modifier Type: MULTIPLICATIVE ----" << std::endl;
+      text << "---- Modifier Type: MULTIPLICATIVE ----\n";
     else
-      std::cout << "---- Modifier Type: ADDITIVE ----" << std::endl;
+      text << "---- Modifier Type: ADDITIVE ----\n";
 
     if(static_cast<uint8_t>(modifier.stat) < AttributeSet::getSize())
-      std::cout << AttributeSet::getName(static_cast<Attribute>(modifier.stat));
+      text << AttributeSet::getName(static_cast<Attribute>(modifier.stat));
     else if(modifier.stat == Attribute::MVIT)
-      std::cout << "MVIT";
+      text << "MVIT";
     else if(modifier.stat == Attribute::MQTD)
-      std::cout << "MQTD";
-    std::cout << " Value: " << modifier.value << std::endl;
+      text << "MQTD";
+    text << " Value: " << modifier.value;
 
     if(modifier.has_lifetime)
-      std::cout << "Lifetime: " << modifier.lifetime << std::endl;
+      text << "\nLifetime: " << modifier.lifetime;
     if(modifier.has_linked_ailment)
-      std::cout << "Linked Ailment: " << modifier.linked_ailment << std::endl;
+      text << "\nLinked Ailment: " << modifier.linked_ailment;
+    LOG_DEBUG(BATTLE, text.str());
   }
 
-  if(modifiers.size() > 0)
-    std::cout << std::endl;
-  else
-    std::cout << "-- No Modifiers Present --" << std::endl;
-#endif
+  if(modifiers.size() == 0)
+    LOG_DEBUG(BATTLE, "-- No Modifiers Present --");
 }
 
 void BattleStats::update(int32_t lifetime_update)
@@ -196,33 +198,30 @@ void BattleStats::update(int32_t lifetime_update)
                   end(modifiers));
 }
 
-uint32_t BattleStats::getBaseValue(Attribute stat)
+uint32_t BattleStats::getBaseValue(Attribute stat) const
 {
   if(static_cast<uint8_t>(stat) < (uint8_t)values.size())
-    return values.at(static_cast<uint8_t>(stat)).second;
+    return values[static_cast<uint8_t>(stat)];
 
   return 0;
 }
 
 // Returns the actual value of the stat after all modifiers
-uint32_t BattleStats::getValue(Attribute stat)
+uint32_t BattleStats::getValue(Attribute stat) const
 {
   double value = getBaseValue(stat);
 
   /* If the given Attribute is a valid index */
   if(static_cast<uint8_t>(stat) < (uint8_t)values.size())
   {
-    /* Obtain all modifiers of the stats */
-    auto stat_modifiers = getModifiersOfStat(stat);
-
-    /* First, apply all multiplicitve modifiers */
-    for(const auto& modifier : stat_modifiers)
-      if(modifier.type == ModifierType::MULTIPLICATIVE)
+    /* First, apply all multiplicitve modifiers of the stat */
+    for(const auto& modifier : modifiers)
+      if(modifier.stat == stat && modifier.type == ModifierType::MULTIPLICATIVE)
         value *= modifier.value;
 
-    /* Second ,apply all additive modifiers */
-    for(const auto& modifier : stat_modifiers)
-      if(modifier.type == ModifierType::ADDITIVE)
+    /* Second ,apply all additive modifiers of the stat */
+    for(const auto& modifier : modifiers)
+      if(modifier.stat == stat && modifier.type == ModifierType::ADDITIVE)
         value += modifier.value;
   }
 
@@ -234,7 +233,8 @@ uint32_t BattleStats::getValue(Attribute stat)
   return final_val;
 }
 
-std::vector<StatModifier> BattleStats::getModifiersOfStat(Attribute battle_stat)
+std::vector<StatModifier>
+BattleStats::getModifiersOfStat(Attribute battle_stat) const
 {
   std::vector<StatModifier> found_modifiers{};
 
@@ -245,7 +245,7 @@ std::vector<StatModifier> BattleStats::getModifiersOfStat(Attribute battle_stat)
   return found_modifiers;
 }
 
-uint32_t BattleStats::getNumAddModifiers(Attribute battle_stat)
+uint32_t BattleStats::getNumAddModifiers(Attribute battle_stat) const
 {
   uint32_t num_add_modifiers = 0;
 
@@ -260,7 +260,7 @@ bool BattleStats::setBaseValue(Attribute stat, uint32_t value)
 {
   if(static_cast<uint8_t>(stat) < (uint8_t)values.size())
   {
-    values[static_cast<uint8_t>(stat)].second = value;
+    values[static_cast<uint8_t>(stat)] = value;
 
     return true;
   }
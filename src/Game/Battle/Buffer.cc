@@ -8,12 +8,19 @@
 * See .h file for TODOs
 *******************************************************************************/
 #include "Game/Battle/Buffer.h"
+#include "Logger.h"
 
 /*=============================================================================
  * CONSTRUCTORS / DESTRUCTORS
  *============================================================================*/
 
-Buffer::Buffer() : index{0}, sorted{false}, action_buffer{}
+Buffer::Buffer()
+    : cooldown_clock{0},
+      index{0},
+      next_sequence{0},
+      sorted{false},
+      skill_counts{},
+      action_buffer{}
 {
 }
 
@@ -21,16 +28,34 @@ Buffer::Buffer() : index{0}, sorted{false}, action_buffer{}
  * PRIVATE FUNCTIONS
  *============================================================================*/
 
+void Buffer::add(BufferAction action)
+{
+  action.sequence = next_sequence++;
+
+  if(action.user && action.used_skill)
+    skill_counts[action.user]++;
+
+  action_buffer.push_back(action);
+}
+
 BufferAction& Buffer::getIndex(const uint32_t& index)
 {
   if(index < action_buffer.size())
     return action_buffer.at(index);
 
-  std::cerr << "[ERROR} Invalid Buffer action selection" << std::endl;
+  LOG_ERROR(BATTLE, "Invalid Buffer action selection");
 
   return action_buffer.at(0);
 }
 
+uint32_t Buffer::getRemainingCooldown(const BufferAction& action)
+{
+  if(action.cooldown_end > cooldown_clock)
+    return action.cooldown_end - cooldown_clock;
+
+  return 0;
+}
+
 std::vector<BufferAction> Buffer::sort(std::vector<BufferAction> actions,
                                        BufferSorts buffer_sorts)
 {
@@ -44,6 +69,35 @@ std::vector<BufferAction> Buffer::sort(std::vector<BufferAction> actions,
   return actions;
 }
 
+void Buffer::untrack(const BufferAction& action)
+{
+  if(action.user && action.used_skill)
+  {
+    auto count = skill_counts.find(action.user);
+
+    if(count != skill_counts.end() && --count->second == 0)
+      skill_counts.erase(count);
+  }
+}
+
+/*=============================================================================
+ * PRIVATE STATIC FUNCTIONS
+ *============================================================================*/
+
+uint16_t Buffer::getPrecedence(ActionType type)
+{
+  if(type == ActionType::DEFEND)
+    return 0;
+  else if(type == ActionType::GUARD)
+    return 1;
+  else if(type == ActionType::ITEM)
+    return 2;
+  else if(type == ActionType::SKILL)
+    return 3;
+
+  return 4;
+}
+
 /*=============================================================================
  * PUBLIC FUNCTIONS
  *============================================================================*/
@@ -53,7 +107,7 @@ void Buffer::addDefend(BattleActor* user)
   BufferAction defend_action;
   defend_action.user = user;
   defend_action.type = ActionType::DEFEND;
-  action_buffer.push_back(defend_action);
+  add(defend_action);
 }
 
 /* Adds a guard element to the buffer */
@@ -65,7 +119,7 @@ void Buffer::addGuard(BattleActor* user, BattleActor* target)
 
   std::vector<BattleActor*> target_vec{target};
   guard_action.targets = target_vec;
-  action_buffer.push_back(guard_action);
+  add(guard_action);
 }
 
 /* Add an imploding element to the buffer */
@@ -74,7 +128,7 @@ void Buffer::addImplode(BattleActor* user)
   BufferAction implode_action;
   implode_action.user = user;
   implode_action.type = ActionType::IMPLODE;
-  action_buffer.push_back(implode_action);
+  add(implode_action);
 }
 
 /* Adds an Item element to the buffer */
@@ -82,7 +136,7 @@ void Buffer::addItem(BattleActor* user, BattleItem* used_item,
                      std::vector<BattleActor*> targets)
 {
   BufferAction item_action;
-  item_action.cooldown = 0;
+  item_action.cooldown_end = cooldown_clock;
   item_action.user = user;
   item_action.type = ActionType::ITEM;
 
@@ -92,7 +146,7 @@ void Buffer::addItem(BattleActor* user, BattleItem* used_item,
 
   std::vector<BattleActor*> target_vec{targets};
   item_action.targets = target_vec;
-  action_buffer.push_back(item_action);
+  add(item_action);
 }
 
 /* Adds a Pass event to the Battle */
@@ -102,7 +156,7 @@ void Buffer::addPass(BattleActor* user, int32_t initial_turn)
   pass_action.user = user;
   pass_action.initial_turn = initial_turn;
   pass_action.type = ActionType::PASS;
-  action_buffer.push_back(pass_action);
+  add(pass_action);
 }
 
 /* Adds a skill use to the buffer */
@@ -114,15 +168,18 @@ void Buffer::addSkill(BattleActor* user, BattleSkill* used_skill,
   skill_action.user = user;
   skill_action.used_skill = used_skill;
   skill_action.targets = targets;
-  skill_action.cooldown = cooldown;
+  skill_action.cooldown_end = cooldown_clock + cooldown;
   skill_action.initial_turn = initial_turn;
   skill_action.type = ActionType::SKILL;
-  action_buffer.push_back(skill_action);
+  add(skill_action);
 }
 
 void Buffer::clear()
 {
   action_buffer.clear();
+  skill_counts.clear();
+  cooldown_clock = 0;
+  next_sequence = 0;
   sorted = false;
   index = 0;
 }
@@ -142,19 +199,18 @@ void Buffer::clearItem()
 
 void Buffer::clearForTurn(uint32_t turn_number)
 {
-  /* Erase remove for all elem's with initial turn matching the given turn # */
+  /* Erase remove for all items and all elem's with initial turn matching the
+   * given turn # that have finished cooling down, in a single pass */
   action_buffer.erase(std::remove_if(begin(action_buffer), end(action_buffer),
                                      [&](const BufferAction& a) -> bool
                                      {
-                                       return (a.initial_turn == turn_number) &&
-                                              (a.cooldown < 1);
-                                     }),
-                      end(action_buffer));
-
-  action_buffer.erase(std::remove_if(begin(action_buffer), end(action_buffer),
-                                     [&](const BufferAction& a) -> bool
-                                     {
-                                       return a.type == ActionType::ITEM;
+                                       bool remove =
+                                           (a.type == ActionType::ITEM) ||
+                                           ((a.initial_turn == turn_number) &&
+                                            (getRemainingCooldown(a) < 1));
+                                       if(remove)
+                                         untrack(a);
+                                       return remove;
                                      }),
                       end(action_buffer));
 
@@ -165,12 +221,7 @@ void Buffer::clearForTurn(uint32_t turn_number)
 
 bool Buffer::hasCoolingSkill(BattleActor* check_person)
 {
-  for(auto element : action_buffer)
-    if(element.user == check_person &&
-       element.used_skill) //&& element.cooldown >= 0)
-      return true;
-
-  return false;
+  return (skill_counts.count(check_person) > 0);
 }
 
 bool Buffer::isIndexProcessed()
@@ -196,69 +247,66 @@ bool Buffer::isSorted()
 
 void Buffer::print(bool simple)
 {
-#ifdef UDEBUG
-  std::cout << "===== [ Action Buffer ] ======\n"
-            << "Size: " << action_buffer.size() << "Curr. Index: " << index
-            << "\n";
+  LOG_DEBUG(BATTLE, "===== [ Action Buffer ] ======\n"
+                        << "Size: " << action_buffer.size()
+                        << "Curr. Index: " << index);
 
-  if(!simple)
+  if(!simple && Logger::isEnabled(LogLevel::DEBUG, LogCategory::BATTLE))
   {
     for(const auto& element : action_buffer)
     {
-      std::cout << "  -- Element -- \n";
-      std::cout << "Type: " << Helpers::actionTypeToStr(element.type) << "\n";
+      std::ostringstream text;
+      text << "  -- Element -- \n";
+      text << "Type: " << Helpers::actionTypeToStr(element.type);
 
       if(element.type == ActionType::SKILL && element.used_skill &&
          element.used_skill->skill)
       {
-        std::cout << "Skill: " << element.used_skill->skill->getName() << "\n";
-        std::cout << "Scope: " << Helpers::actionScopeToStr(
-                                      element.used_skill->skill->getScope())
-                  << "\n";
-        std::cout << "Cooldown: " << element.cooldown << "\n";
-        std::cout << "Initial Turn: " << element.initial_turn << "\n";
+        text << "\nSkill: " << element.used_skill->skill->getName();
+        text << "\nScope: " << Helpers::actionScopeToStr(
+                                     element.used_skill->skill->getScope());
+        text << "\nCooldown: " << getRemainingCooldown(element);
+        text << "\nInitial Turn: " << element.initial_turn;
       }
       else if(element.type == ActionType::ITEM && element.owned_item)
       {
-        std::cout << "Item: " << element.owned_item->getName() << "\n";
+        text << "\nItem: " << element.owned_item->getName();
 
         if(element.owned_item->getUseSkill())
         {
-          std::cout << "Item Skill: "
-                    << element.owned_item->getUseSkill()->getName() << "\n";
-          std::cout << "Scope: "
-                    << Helpers::actionScopeToStr(
-                           element.owned_item->getUseSkill()->getScope())
-                    << "\n";
+          text << "\nItem Skill: "
+               << element.owned_item->getUseSkill()->getName();
+          text << "\nScope: "
+               << Helpers::actionScopeToStr(
+                      element.owned_item->getUseSkill()->getScope());
         }
       }
 
       if(element.user && element.user->getBasePerson())
       {
-        std::cout << "User: " << element.user->getBasePerson()->getName()
-                  << "\n";
-        std::cout << "User Speed: "
-                  << element.user->getStats().getValue(Attribute::LIMB) << "\n";
+        text << "\nUser: " << element.user->getBasePerson()->getName();
+        text << "\nUser Speed: "
+             << element.user->getStats().getValue(Attribute::LIMB);
       }
 
       for(const auto& target : element.targets)
         if(target && target->getBasePerson())
-          std::cout << "Target: " << target->getBasePerson()->getName() << "\n";
+          text << "\nTarget: " << target->getBasePerson()->getName();
+
+      LOG_DEBUG(BATTLE, text.str());
     }
   }
-
-  std::cout << std::endl;
-#endif
 }
 
 void Buffer::removeAllByUser(BattleActor* user)
 {
   action_buffer.erase(std::remove_if(begin(action_buffer), end(action_buffer),
-                                     [&](BufferAction x) -> bool
+                                     [&](const BufferAction& x) -> bool
                                      {
                                        return (x.user == user);
                                      }),
                       end(action_buffer));
+  skill_counts.erase(user);
 
   auto new_size = action_buffer.size();
 
@@ -269,9 +317,8 @@ void Buffer::removeAllByUser(BattleActor* user)
 
 void Buffer::updateCooldowns()
 {
-  for(auto& element : action_buffer)
-    if(element.cooldown != 0)
-      --element.cooldown;
+  /* Every element's remaining cooldown is relative to the clock */
+  cooldown_clock++;
 }
 
 ActionType Buffer::getActionType()
@@ -285,7 +332,7 @@ ActionType Buffer::getActionType()
 int32_t Buffer::getCooldown()
 {
   if(index < action_buffer.size())
-    return getIndex(index).cooldown;
+    return getRemainingCooldown(getIndex(index));
 
   return -1;
 }
@@ -359,21 +406,27 @@ void Buffer::reorder()
 {
   /* Precedence of Action Types (each action type sorted by momentum)
    * ---- DEFEND, GUARD, ITEM, SKILL, OTHER ----
-   * Sorting takes place by the value of the integer equiv. ActionType enum
+   * Ties in momentum keep the order the actions were added. The momentum is
+   * read once per element so the sort compares fixed keys.
    */
-  std::sort(begin(action_buffer), end(action_buffer),
-            [&](const BufferAction& a, const BufferAction& b) -> bool
-            {
-              return (static_cast<uint16_t>(a.type) <
-                      static_cast<uint16_t>(b.type));
-            });
+  for(auto& element : action_buffer)
+  {
+    element.momentum = 0;
+    if(element.user)
+      element.momentum = element.user->getStats().getValue(Attribute::LIMB);
+  }
 
   std::sort(begin(action_buffer), end(action_buffer),
             [&](const BufferAction& a, const BufferAction& b) -> bool
             {
-
-              return (a.user->getStats().getValue(Attribute::LIMB) >=
-                      b.user->getStats().getValue(Attribute::LIMB));
+              auto a_precedence = getPrecedence(a.type);
+              auto b_precedence = getPrecedence(b.type);
+
+              if(a_precedence != b_precedence)
+                return (a_precedence < b_precedence);
+              if(a.momentum != b.momentum)
+                return (a.momentum > b.momentum);
+              return (a.sequence < b.sequence);
             });
 
   sorted = true;
@@ -46,6 +46,7 @@ RenderElement::RenderElement()
       element_sprite{nullptr},
       loops_to_do{0},
       element_text{Text()},
+      shadow_text{Text()},
       element_font{nullptr},
       color{0, 0, 0, 0},
       shadow_color{0, 0, 0, 0},
@@ -84,18 +85,7 @@ RenderElement::RenderElement(SDL_Renderer* renderer, Sprite* animation,
     : RenderElement()
 {
   this->renderer = renderer;
-
-  if(animation)
-    element_sprite = new Sprite(*(animation));
-
-  if(element_sprite)
-    element_sprite->resetLoops();
-
-  loops_to_do = num_loops;
-  status = initialStatusFade();
-  render_type = RenderType::PLEP;
-  location.point.x = point.x;
-  location.point.y = point.y;
+  createAsPlep(animation, num_loops, point);
 }
 
 RenderElement::RenderElement(SDL_Renderer* renderer, Box location,
@@ -195,12 +185,14 @@ void RenderElement::createAsDamageText(std::string text, DamageType type,
   setAcceleration(0.000, 0.000);
   setVelocity(0.005, -0.020);
 
+  /* Only size the text here. Values render from the battle digit strip and
+   * anything else is rendered by the battle on first use */
   if(element_font && renderer)
   {
-    element_text = Text(element_font);
-    element_text.setText(renderer, text, color);
+    int text_w = 0;
+    TTF_SizeText(element_font, text.c_str(), &text_w, nullptr);
 
-    auto half_w = element_text.getWidth() / 2;
+    auto half_w = text_w / 2;
     location.point.x = x + (Battle::kPERSON_WIDTH / 2) - half_w;
     location.point.y = y + half_w + (sc_height / 13);
   }
@@ -216,6 +208,22 @@ void RenderElement::createAsDamageValue(int32_t amount, DamageType type,
   render_type = RenderType::DAMAGE_TEXT;
 }
 
+void RenderElement::createAsPlep(Sprite* animation, int32_t num_loops,
+                                 Coordinate point)
+{
+  if(animation && !element_sprite)
+    element_sprite = new Sprite(*(animation));
+
+  if(element_sprite)
+    element_sprite->resetLoops();
+
+  loops_to_do = num_loops;
+  status = initialStatusFade();
+  render_type = RenderType::PLEP;
+  location.point.x = point.x;
+  location.point.y = point.y;
+}
+
 void RenderElement::createAsRegenValue(int32_t amount, DamageType type,
                                        int32_t sc_height, int32_t x, int32_t y)
 {
@@ -302,6 +310,40 @@ void RenderElement::createAsVictoryText(std::string victory_text,
   }
 }
 
+void RenderElement::reset(SDL_Renderer* renderer, TTF_Font* element_font)
+{
+  if(element_sprite)
+    delete element_sprite;
+  element_sprite = nullptr;
+
+  /* The text textures are rebuilt lazily on the next render */
+  element_text.unsetTexture();
+  shadow_text.unsetTexture();
+  text_string.clear();
+
+  has_shadow = false;
+  timeable = true;
+  location = Box();
+  shadow_offset = Coordinate();
+  velocity = Floatinate();
+  acceleration = Floatinate();
+  delta = Floatinate();
+  time_fade_in = 0;
+  time_fade_out = 0;
+  time_begin = 0;
+  time_left = 0;
+  alpha = 0;
+  fade_rate = 0;
+  loops_to_do = 0;
+  color = {0, 0, 0, 0};
+  shadow_color = {0, 0, 0, 0};
+  status = RenderStatus::DISPLAYING;
+  render_type = RenderType::NONE;
+
+  this->element_font = element_font;
+  this->renderer = renderer;
+}
+
 void RenderElement::setShadow(SDL_Color shadow_color, int32_t offset_x,
                               int32_t offset_y)
 {
@@ -37,33 +37,38 @@ EventHandler::~EventHandler()
  * PRIVATE FUNCTIONS
  *===========================================================================*/
 
-/* Returns the event in the queue: either from the set or event pointer */
-bool EventHandler::getEvent(Event& event, bool trigger)
+/* Returns the event in the queue: either from the set, event pointer or the
+ * queue entry. The event is referenced in place and never copied */
+bool EventHandler::getEvent(const Event*& event, bool trigger)
 {
+  event = nullptr;
+
   if(pollEventAvailable())
   {
-    if(event_queue[queue_index].event_set != nullptr)
+    EventExecution& executed_event = event_queue[queue_index];
+
+    if(executed_event.event_set != nullptr)
     {
-      event = event_queue[queue_index].event_set->getEvent(trigger);
+      event = executed_event.event_set->getEventRef(trigger);
     }
-    else if(event_queue[queue_index].event_ref != nullptr)
+    else if(executed_event.event_ref != nullptr)
     {
-      event = *(event_queue[queue_index].event_ref);
+      event = executed_event.event_ref;
       if(trigger)
       {
-        if(event_queue[queue_index].event_ref_inst != nullptr)
-          event_queue[queue_index].event_ref_inst->has_exec = true;
+        if(executed_event.event_ref_inst != nullptr)
+          executed_event.event_ref_inst->has_exec = true;
         else
-          event_queue[queue_index].event_ref->has_exec = true;
+          executed_event.event_ref->has_exec = true;
       }
     }
     else
     {
-      event = event_queue[queue_index].event;
+      event = &executed_event.event;
     }
-    return true;
   }
-  return false;
+
+  return (event != nullptr);
 }
 
 /* Returns the event pair ref in the queue: either from the set or event
@@ -105,7 +110,7 @@ bool EventHandler::getEventRef(Event*& event_ref, bool trigger)
 }
 
 /* Trigger queue sound */
-void EventHandler::triggerQueueSound(Event event)
+void EventHandler::triggerQueueSound(const Event& event)
 {
   if(event.sound_id >= 0)
     triggerSound(event.sound_id, SoundChannels::TRIGGERS);
@@ -121,9 +126,9 @@ void EventHandler::executeEvent(Event event, MapPerson* initiator,
 {
   if(event.classification != EventClassifier::NOEVENT)
   {
-    /* Create the executed event queue entry */
+    /* Create the executed event queue entry, taking over the event */
     EventExecution executed_event;
-    executed_event.event = event;
+    executed_event.event = std::move(event);
     executed_event.event_ref = nullptr;
     executed_event.event_ref_inst = nullptr;
     executed_event.event_set = nullptr;
@@ -132,7 +137,7 @@ void EventHandler::executeEvent(Event event, MapPerson* initiator,
     executed_event.source = source;
 
     /* Push the event to the back of the queue */
-    event_queue.push_back(executed_event);
+    event_queue.push_back(std::move(executed_event));
   }
 }
 
@@ -166,7 +171,7 @@ void EventHandler::executeEventRef(Event* event, Event* event_inst,
     executed_event.source = source;
 
     /* Push the event to the back of the queue */
-    event_queue.push_back(executed_event);
+    event_queue.push_back(std::move(executed_event));
   }
 }
 
@@ -187,7 +192,7 @@ void EventHandler::executeEventSet(EventSet* set, MapPerson* initiator,
     executed_event.source = source;
 
     /* Push the event to the back of the queue */
-    event_queue.push_back(executed_event);
+    event_queue.push_back(std::move(executed_event));
   }
 }
 
@@ -213,7 +218,7 @@ void EventHandler::executeIOShift(MapInteractiveObject* io,
     executed_event.event.ints.push_back(interaction_state);
 
     /* Push the event to the back of the queue */
-    event_queue.push_back(executed_event);
+    event_queue.push_back(std::move(executed_event));
   }
 }
 
@@ -226,7 +231,7 @@ void EventHandler::executePickup(MapItem* item, bool walkover)
   new_event.ints.push_back(walkover);
 
   /* Now execute the pickup event (throw it on the queue) */
-  executeEvent(new_event, NULL);
+  executeEvent(std::move(new_event), NULL);
   event_queue.back().item = item;
 }
 
@@ -236,34 +241,22 @@ SoundHandler* EventHandler::getSoundHandler()
   return sound_handler;
 }
 
-/* Print a value if debug is enabled */
-void EventHandler::log(std::string raw)
+/* Logs the text at the debug level, through the Logger */
+void EventHandler::log(const std::string& raw)
 {
-#ifdef UDEBUG
-  std::cout << raw << std::endl;
-#else
-  (void)raw;
-#endif
+  LOG_DEBUG(GENERAL, raw);
 }
 
-/* Log an error/warning if UDEBUG is set (cleans up macrocode elsewhere) */
-void EventHandler::logError(std::string raw)
+/* Logs an error, through the Logger */
+void EventHandler::logError(const std::string& raw)
 {
-#ifdef UDEBUG
-  std::cerr << "[ERROR] " << raw << std::endl;
-#else
-  (void)raw;
-#endif
+  LOG_ERROR(GENERAL, raw);
 }
 
-/* Log an error/warning if UDEBUG is set (cleans up macrocode elsewhere) */
-void EventHandler::logWarning(std::string raw)
+/* Logs a warning, through the Logger */
+void EventHandler::logWarning(const std::string& raw)
 {
-#ifdef UDEBUG
-  std::cout << "[WARNING] " << raw << std::endl;
-#else
-  (void)raw;
-#endif
+  LOG_WARNING(GENERAL, raw);
 }
 
 /* Clears the event handling poll queue */
@@ -297,11 +290,11 @@ bool EventHandler::pollConversation(ConvoPair& convo_pair, MapThing** source)
 bool EventHandler::pollGiveItem(int& id, int& count, GiveItemFlags& flags,
                                 int& chance)
 {
-  Event event;
+  const Event* event;
   if(getEvent(event, true) &&
-     EventSet::dataEventGiveItem(event, id, count, flags, chance))
+     EventSet::dataEventGiveItem(*event, id, count, flags, chance))
   {
-    triggerQueueSound(event);
+    triggerQueueSound(*event);
     return true;
   }
   return false;
@@ -330,10 +323,10 @@ bool EventHandler::pollEventAvailable()
 /* Returns the current event type, to be polled by the management class */
 EventClassifier EventHandler::pollEventType()
 {
-  Event event;
+  const Event* event;
   if(getEvent(event, false))
   {
-    return event.classification;
+    return event->classification;
   }
   return EventClassifier::NOEVENT;
 }
@@ -426,7 +419,7 @@ bool EventHandler::pollNone()
 {
   if(pollEventType() == EventClassifier::NOEVENT)
   {
-    Event event;
+    const Event* event;
     getEvent(event, true);
     return true;
   }
@@ -438,12 +431,12 @@ bool EventHandler::pollNotification(std::string* notification)
 {
   if(notification != nullptr)
   {
-    Event event;
+    const Event* event;
     if(getEvent(event, true) &&
-       EventSet::dataEventNotification(event, *notification))
+       EventSet::dataEventNotification(*event, *notification))
     {
 
-      triggerQueueSound(event);
+      triggerQueueSound(*event);
       return true;
     }
   }
@@ -471,13 +464,13 @@ bool EventHandler::pollPropMod(MapThing*& source, ThingBase& type, int& id,
                                int& respawn, int& speed, TrackingState& track,
                                int& inactive)
 {
-  Event event;
+  const Event* event;
   if(getEvent(event, true) &&
-     EventSet::dataEventPropMod(event, type, id, props, bools, respawn, speed,
+     EventSet::dataEventPropMod(*event, type, id, props, bools, respawn, speed,
                                 track, inactive))
   {
     source = event_queue[queue_index].source;
-    triggerQueueSound(event);
+    triggerQueueSound(*event);
     return true;
   }
   return false;
@@ -503,10 +496,10 @@ bool EventHandler::pollShiftIO(MapInteractiveObject** io, int* state,
 /* Poll a sound event */
 bool EventHandler::pollSound()
 {
-  Event event;
+  const Event* event;
   if(pollEventType() == EventClassifier::SOUNDONLY && getEvent(event, true))
   {
-    triggerQueueSound(event);
+    triggerQueueSound(*event);
     return true;
   }
   return false;
@@ -544,10 +537,10 @@ bool EventHandler::pollStartMap(int* id)
 {
   if(id != nullptr)
   {
-    Event event;
-    if(getEvent(event, true) && EventSet::dataEventStartMap(event, *id))
+    const Event* event;
+    if(getEvent(event, true) && EventSet::dataEventStartMap(*event, *id))
     {
-      triggerQueueSound(event);
+      triggerQueueSound(*event);
       return true;
     }
   }
@@ -559,10 +552,11 @@ bool EventHandler::pollTakeItem(int* id, int* count)
 {
   if(id != nullptr && count != nullptr)
   {
-    Event event;
-    if(getEvent(event, true) && EventSet::dataEventTakeItem(event, *id, *count))
+    const Event* event;
+    if(getEvent(event, true) &&
+       EventSet::dataEventTakeItem(*event, *id, *count))
     {
-      triggerQueueSound(event);
+      triggerQueueSound(*event);
       return true;
     }
   }
@@ -576,11 +570,11 @@ bool EventHandler::pollTeleportThing(int* thing_id, int* x, int* y,
   if(thing_id != nullptr && x != nullptr && y != nullptr &&
      section_id != nullptr)
   {
-    Event event;
+    const Event* event;
     if(getEvent(event, true) &&
-       EventSet::dataEventTeleport(event, *thing_id, *x, *y, *section_id))
+       EventSet::dataEventTeleport(*event, *thing_id, *x, *y, *section_id))
     {
-      triggerQueueSound(event);
+      triggerQueueSound(*event);
       return true;
     }
   }
@@ -591,13 +585,13 @@ bool EventHandler::pollTeleportThing(int* thing_id, int* x, int* y,
 bool EventHandler::pollTriggerIO(MapThing*& source, int& io_id,
                                  MapPerson*& initiator)
 {
-  Event event;
+  const Event* event;
   if(getEvent(event, true) &&
-     EventSet::dataEventTriggerIO(event, io_id))
+     EventSet::dataEventTriggerIO(*event, io_id))
   {
     source = event_queue[queue_index].source;
     initiator = event_queue[queue_index].initiator;
-    triggerQueueSound(event);
+    triggerQueueSound(*event);
     return true;
   }
   return false;
@@ -612,13 +606,13 @@ bool EventHandler::pollUnlockIO(MapThing*& source, int* io_id,
   if(io_id != nullptr && mode != nullptr && state_num != nullptr &&
      mode_events != nullptr && mode_view != nullptr && view_time != nullptr)
   {
-    Event event;
+    const Event* event;
     if(getEvent(event, true) &&
-       EventSet::dataEventUnlockIO(event, *io_id, *mode, *state_num,
+       EventSet::dataEventUnlockIO(*event, *io_id, *mode, *state_num,
                                    *mode_events, *mode_view, *view_time))
     {
       source = event_queue[queue_index].source;
-      triggerQueueSound(event);
+      triggerQueueSound(*event);
       return true;
     }
   }
@@ -631,12 +625,12 @@ bool EventHandler::pollUnlockThing(MapThing*& source, int* thing_id,
 {
   if(thing_id != nullptr && mode_view != nullptr && view_time != nullptr)
   {
-    Event event;
+    const Event* event;
     if(getEvent(event, true) &&
-       EventSet::dataEventUnlockThing(event, *thing_id, *mode_view, *view_time))
+       EventSet::dataEventUnlockThing(*event, *thing_id, *mode_view, *view_time))
     {
       source = event_queue[queue_index].source;
-      triggerQueueSound(event);
+      triggerQueueSound(*event);
       return true;
     }
   }
@@ -651,12 +645,12 @@ bool EventHandler::pollUnlockTile(int* section_id, int* tile_x, int* tile_y,
   if(section_id != nullptr && tile_x != nullptr && tile_y != nullptr &&
      mode != nullptr && mode_view != nullptr && view_time != nullptr)
   {
-    Event event;
+    const Event* event;
     if(getEvent(event, true) &&
-       EventSet::dataEventUnlockTile(event, *section_id, *tile_x, *tile_y,
+       EventSet::dataEventUnlockTile(*event, *section_id, *tile_x, *tile_y,
                                      *mode, *mode_view, *view_time))
     {
-      triggerQueueSound(event);
+      triggerQueueSound(*event);
       return true;
     }
   }
@@ -70,6 +70,7 @@ const int32_t EventSet::kUNSET_ID = -1;
 EventSet::EventSet()
 {
   base = nullptr;
+  dirty = false;
   event_locked = createBlankEvent();
   events_unlocked.clear();
 
@@ -236,6 +237,7 @@ bool EventSet::addEventUnlocked(Event new_event)
 void EventSet::clear()
 {
   base = nullptr;
+  dirty = true;
   get_index = -1;
   unlocked_state = UnlockedState::ORDERED;
 
@@ -382,6 +384,7 @@ EventPair EventSet::getEventPair(bool trigger)
   if(trigger)
   {
     unlockUsed(locked_status);
+    dirty = true;
   }
 
   /* Trigger and return */
@@ -585,6 +588,19 @@ bool EventSet::isDataToSave()
   return false;
 }
 
+/*
+ * Description: Returns if the state written by saveData() may have changed
+ *              since the dirty flag was last cleared. Set when the set is
+ *              triggered or the lock changes.
+ *
+ * Inputs: none
+ * Output: bool - true if the set needs to be saved again
+ */
+bool EventSet::isDirty()
+{
+  return dirty;
+}
+
 /*
  * Description: Returns if the event set has any events or data set. If true,
  *              there are no events. It will always return true after a clear()
@@ -830,6 +846,18 @@ void EventSet::setBase(EventSet* new_base)
   }
 }
 
+/*
+ * Description: Sets the save dirty flag. It is cleared by the owner once the
+ *              set has been saved.
+ *
+ * Inputs: bool dirty - true to mark the set as changed. Default true
+ * Output: none
+ */
+void EventSet::setDirty(bool dirty)
+{
+  this->dirty = dirty;
+}
+
 /*
  * Description: Sets the event to be used while the set is locked. Once set,
  *              the class takes control of any memory management.
@@ -921,6 +949,7 @@ bool EventSet::setLocked(Locked new_locked)
 //  if(!isBaseSet())
 //  {
   locked_status = new_locked;
+  dirty = true;
   return true;
 //  }
 //  return false;
@@ -955,6 +984,7 @@ bool EventSet::unlockTrigger()
   if(isLocked())
   {
     unlockTrigger(locked_status);
+    dirty = true;
     return !locked_status.is_locked;
   }
   return false;
@@ -2109,7 +2139,7 @@ void EventSet::dataEnumView(UnlockView view_enum, bool& view, bool& scroll)
 /*
  * Description: Extracts data from the passed in event if its a give item event.
  *
- * Inputs: Event event - the event to extract the data from
+ * Inputs: const Event& event - the event to extract the data from
  *         int& item_id - the give item ID reference
  *         int& count - the give item count reference
  *         GiveItemFlags& flags - the give item control flags
@@ -2117,7 +2147,7 @@ void EventSet::dataEnumView(UnlockView view_enum, bool& view, bool& scroll)
  * Output: bool - true if the data was extracted. Fails if the event is the
  *                wrong category
  */
-bool EventSet::dataEventGiveItem(Event event, int& item_id, int& count,
+bool EventSet::dataEventGiveItem(const Event& event, int& item_id, int& count,
                                  GiveItemFlags& flags, int& chance)
 {
   if(event.classification == EventClassifier::ITEMGIVE &&
@@ -2137,12 +2167,13 @@ bool EventSet::dataEventGiveItem(Event event, int& item_id, int& count,
  * Description: Extracts data from the passed in event if its a multiple event.
  *              This only pulls the data as is by value; not a reference.
  *
- * Inputs: Event event - the event val to extract the data from
+ * Inputs: const Event& event - the event val to extract the data from
  *         std::vector<Event>& event_list - set of event list structs
  * Output: bool - true if the data was extracted. Fails if the event is the
  *                wrong category
  */
-bool EventSet::dataEventMultiple(Event event, std::vector<Event>& event_list)
+bool EventSet::dataEventMultiple(const Event& event,
+                                 std::vector<Event>& event_list)
 {
   if(event.classification == EventClassifier::MULTIPLE)
   {
@@ -2182,12 +2213,13 @@ bool EventSet::dataEventMultiple(Event* event,
  * Description: Extracts data from the passed in event if its a notification
  *              event.
  *
- * Inputs: Event event - the event to extract the data from
+ * Inputs: const Event& event - the event to extract the data from
  *         std::string& notification - the notification string reference
  * Output: bool - true if the data was extracted. Fails if the event is the
  *                wrong category
  */
-bool EventSet::dataEventNotification(Event event, std::string& notification)
+bool EventSet::dataEventNotification(const Event& event,
+                                     std::string& notification)
 {
   if(event.classification == EventClassifier::NOTIFICATION &&
      event.strings.size() > 0)
@@ -2202,7 +2234,7 @@ bool EventSet::dataEventNotification(Event event, std::string& notification)
  * Description: Public static. Extracts data from the passed in property
  *              modifier event.
  *
- * Inputs: Event event - the event to extract the data from
+ * Inputs: const Event& event - the event to extract the data from
  *         ThingBase type - the type of thing modified by the event
  *         int id - the id of the thing
  *         ThingProperty props - which properties are being modified by the call
@@ -2214,7 +2246,7 @@ bool EventSet::dataEventNotification(Event event, std::string& notification)
  * Output: bool - true if the data was extracted. Fails if the event is the
  *                wrong category
  */
-bool EventSet::dataEventPropMod(Event event, ThingBase& type, int& id,
+bool EventSet::dataEventPropMod(const Event& event, ThingBase& type, int& id,
                                 ThingProperty& props, ThingProperty& bools,
                                 int& respawn, int& speed, TrackingState& track,
                                 int& inactive)
@@ -2264,12 +2296,12 @@ bool EventSet::dataEventStartBattle(Event* event, BattleFlags& flags,
 /*
  * Description: Extracts data from the passed in event if its a start map event.
  *
- * Inputs: Event event - the event to extract the data from
+ * Inputs: const Event& event - the event to extract the data from
  *         int& map_id - the start map ID reference
  * Output: bool - true if the data was extracted. Fails if the event is the
  *                wrong category
  */
-bool EventSet::dataEventStartMap(Event event, int& map_id)
+bool EventSet::dataEventStartMap(const Event& event, int& map_id)
 {
   if(event.classification == EventClassifier::MAPSWITCH &&
      event.ints.size() > kMAP_ID)
@@ -2283,13 +2315,13 @@ bool EventSet::dataEventStartMap(Event event, int& map_id)
 /*
  * Description: Extracts data from the passed in event if its a take item event
  *
- * Inputs: Event event - the event to extract the data from
+ * Inputs: const Event& event - the event to extract the data from
  *         int& item_id - the take item ID reference
  *         int& count - the take item count reference
  * Output: bool - true if the data was extracted. Fails if the event is the
  *                wrong category
  */
-bool EventSet::dataEventTakeItem(Event event, int& item_id, int& count)
+bool EventSet::dataEventTakeItem(const Event& event, int& item_id, int& count)
 {
   if(event.classification == EventClassifier::ITEMTAKE &&
      event.ints.size() > kTAKE_ITEM_COUNT)
@@ -2305,7 +2337,7 @@ bool EventSet::dataEventTakeItem(Event event, int& item_id, int& count)
  * Description: Extracts data from the passed in event if its a teleport thing
  *              event.
  *
- * Inputs: Event event - the event to extract the data from
+ * Inputs: const Event& event - the event to extract the data from
  *         int& thing_id - the teleport thing ID reference
  *         int& x - the teleport thing tile X reference
  *         int& y - the teleport thing tile Y reference
@@ -2313,8 +2345,8 @@ bool EventSet::dataEventTakeItem(Event event, int& item_id, int& count)
  * Output: bool - true if the data was extracted. Fails if the event is the
  *                wrong category
  */
-bool EventSet::dataEventTeleport(Event event, int& thing_id, int& x, int& y,
-                                int& section_id)
+bool EventSet::dataEventTeleport(const Event& event, int& thing_id, int& x,
+                                 int& y, int& section_id)
 {
   if(event.classification == EventClassifier::TELEPORTTHING &&
      event.ints.size() > kTELEPORT_SECTION)
@@ -2332,12 +2364,12 @@ bool EventSet::dataEventTeleport(Event event, int& thing_id, int& x, int& y,
  * Description: Extracts data from the passed in event if its a trigger IO
  *              event.
  *
- * Inputs: Event event - the event to extract the data from
+ * Inputs: const Event& event - the event to extract the data from
  *         int& io_id - the IO id to unlock
  * Output: bool - true if the data was extracted. Fails if event is the wrong
  *                category
  */
-bool EventSet::dataEventTriggerIO(Event event, int& io_id)
+bool EventSet::dataEventTriggerIO(const Event& event, int& io_id)
 {
   if(event.classification == EventClassifier::TRIGGERIO &&
      event.ints.size() > kTRIGGER_ID)
@@ -2352,7 +2384,7 @@ bool EventSet::dataEventTriggerIO(Event event, int& io_id)
  * Description: Extracts data from the passed in event if its an unlock IO
  *              event.
  *
- * Inputs: Event event - the event to extract the data from
+ * Inputs: const Event& event - the event to extract the data from
  *         int& io_id - the IO id to unlock
  *         UnlockIOMode& mode - the mode enum for how the IO is unlocked
  *         int& state_num - the state to parse for unlock attempts
@@ -2362,8 +2394,9 @@ bool EventSet::dataEventTriggerIO(Event event, int& io_id)
  * Output: bool - true if the data was extracted. Fails if event is the wrong
  *                category
  */
-bool EventSet::dataEventUnlockIO(Event event, int& io_id, UnlockIOMode& mode,
-                                 int& state_num, UnlockIOEvent& mode_events,
+bool EventSet::dataEventUnlockIO(const Event& event, int& io_id,
+                                 UnlockIOMode& mode, int& state_num,
+                                 UnlockIOEvent& mode_events,
                                  UnlockView& mode_view, int& view_time)
 {
   if(event.classification == EventClassifier::UNLOCKIO &&
@@ -2384,14 +2417,14 @@ bool EventSet::dataEventUnlockIO(Event event, int& io_id, UnlockIOMode& mode,
  * Description: Extracts data from the passed in event if its an unlock thing
  *              event.
  *
- * Inputs: Event event - the event to extract the data from
+ * Inputs: const Event& event - the event to extract the data from
  *         int& thing_id - the thing ID to unlock
  *         UnlockView& mode_view - how the unlocked is viewed
  *         int& view_time - the length of time the unlocked is viewed
  * Output: bool - true if the data was extracted. Fails if event is the wrong
  *                category
  */
-bool EventSet::dataEventUnlockThing(Event event, int& thing_id,
+bool EventSet::dataEventUnlockThing(const Event& event, int& thing_id,
                                     UnlockView& mode_view, int& view_time)
 {
   if(event.classification == EventClassifier::UNLOCKTHING &&
@@ -2409,7 +2442,7 @@ bool EventSet::dataEventUnlockThing(Event event, int& thing_id,
  * Description: Extracts data from the passed in event if its an unlock tile
  *              event.
  *
- * Inputs: Event event - the event to extract the data from
+ * Inputs: const Event& event - the event to extract the data from
  *         int& section_id - the sub-map section ID to access the tile
  *         int& tile_x - the tile X location within the sub-map
  *         int& tile_y - the tile Y location within the sub-map
@@ -2419,9 +2452,10 @@ bool EventSet::dataEventUnlockThing(Event event, int& thing_id,
  * Output: bool - true if the data was extracted. Fails if event is the wrong
  *                category
  */
-bool EventSet::dataEventUnlockTile(Event event, int& section_id, int& tile_x,
-                                   int& tile_y, UnlockTileMode& mode,
-                                   UnlockView& mode_view, int& view_time)
+bool EventSet::dataEventUnlockTile(const Event& event, int& section_id,
+                                   int& tile_x, int& tile_y,
+                                   UnlockTileMode& mode, UnlockView& mode_view,
+                                   int& view_time)
 {
   if(event.classification == EventClassifier::UNLOCKTILE &&
      event.ints.size() > kUNTILE_VIEW_TIME)
@@ -2441,13 +2475,14 @@ bool EventSet::dataEventUnlockTile(Event event, int& section_id, int& tile_x,
  * Description: Extracts data from the locked struct regarding the have item
  *              unlock trigger.
  *
- * Inputs: Locked lock - the locked data struct
+ * Inputs: const Locked& lock - the locked data struct
  *         int& id - the item ID reference
  *         int& count - the item count reference
  *         bool& consume - if the item is consumed bool reference
  * Output: bool - true if the data from the retrieval is valid
  */
-bool EventSet::dataLockedItem(Locked lock, int& id, int& count, bool& consume)
+bool EventSet::dataLockedItem(const Locked& lock, int& id, int& count,
+                              bool& consume)
 {
   if(lock.state == LockedState::ITEM && lock.is_locked &&
      lock.ints.size() > kHAVE_ITEM_COUNT &&
@@ -23,10 +23,13 @@
  * CONSTANTS
  *============================================================================*/
 
-const std::string Game::kSAVE_IMG_BACK = ".bmp";
+const std::string Game::kSAVE_IMG_BACK = ".png";
+const std::string Game::kSAVE_IMG_LEGACY = ".bmp";
+const uint8_t Game::kSAVE_IMG_SCALE = 4;
 const std::string Game::kSAVE_PATH_AUTO = "_auto";
 const std::string Game::kSAVE_PATH_BACK = ".save";
 const std::string Game::kSAVE_PATH_FRONT = "saves/slot";
+const std::string Game::kSAVE_PATH_MAP = "_map";
 const uint8_t Game::kSAVE_SLOT_DEFAULT = 1;
 const uint8_t Game::kSAVE_SLOT_MAX = 30;
 
@@ -58,6 +61,11 @@ Game::Game(Options* running_config)
   player_name = "Player";
   player_sex = Sex::FEMALE;
   save_slot = 0;
+  shot_frame = nullptr;
+  shot_path = "";
+  shot_rendered = false;
+  shot_requested = false;
+  shot_target = nullptr;
 
   /* Set up map class */
   map_ctrl.setConfiguration(config);
@@ -78,6 +86,16 @@ Game::~Game()
   /* First, unload the game */
   unload();
 
+  /* Finish any snapshot write and free the capture targets */
+  if(shot_job.valid())
+    shot_job.wait();
+  if(shot_frame != nullptr)
+    SDL_DestroyTexture(shot_frame);
+  shot_frame = nullptr;
+  if(shot_target != nullptr)
+    SDL_DestroyTexture(shot_target);
+  shot_target = nullptr;
+
   /* Clean config */
   config = nullptr;
 
@@ -730,6 +748,37 @@ std::vector<ItemData> Game::getItemData()
   return data_set;
 }
 
+/* Returns the map levels with section files in the save slot, and the number
+ * of sections saved for each. Read from the index in the slot file */
+std::map<int, uint16_t> Game::getSlotMaps(uint8_t slot, bool encryption)
+{
+  std::map<int, uint16_t> slot_maps;
+  std::string path = getSlotPath(slot, config->getBasePath());
+
+  FileHandler fh_slot(path, false, true, encryption);
+  if(FileHandler::fileExists(path) && fh_slot.start())
+  {
+    bool done = false;
+    bool success = true;
+
+    do
+    {
+      XmlData data = fh_slot.readXmlData(&done, &success);
+      if(data.getElement(0) == "game" && data.getElement(1) == "mapfiles" &&
+         !data.getKeyValue(1).empty())
+      {
+        int count = data.getDataInteger(&success);
+        if(success && count > 0)
+          slot_maps[std::stoi(data.getKeyValue(1))] = count;
+      }
+    } while(!done && success);
+
+    fh_slot.stop();
+  }
+
+  return slot_maps;
+}
+
 /* Load game - main function call */
 bool Game::load(std::string base_file, SDL_Renderer* renderer, uint8_t slot,
                 bool encryption, bool full_load)
@@ -799,11 +848,25 @@ bool Game::load(std::string base_file, SDL_Renderer* renderer, uint8_t slot,
 
     // std::cout << "5: " << success << std::endl;
 
-    /* Slot file */
+    /* Slot file, then the map section files on top of it */
     if(slot_valid)
     {
       fh_slot.xmlToHead();
       success &= loadData(&fh_slot, renderer, false, true, level);
+
+      uint16_t sections = getSlotMaps(slot, encryption)[map_lvl];
+      for(uint16_t i = 0; success && i < sections; i++)
+      {
+        FileHandler fh_section(
+            getSlotMapPath(slot, config->getBasePath(), map_lvl, i), false,
+            true, encryption);
+        success &= fh_section.start();
+        if(success)
+        {
+          success &= loadData(&fh_section, renderer, false, true, level);
+          success &= fh_section.stop();
+        }
+      }
     }
   }
 
@@ -1180,8 +1243,7 @@ bool Game::loadData(XmlData data, int index, SDL_Renderer* renderer,
 void Game::menuPreparation()
 {
   /* Save screenshot */
-  saveScreenshot(getSlotPath(0, config->getBasePath(), true, true),
-                 map_ctrl.getSnapshotRect(), active_renderer);
+  requestScreenshot(getSlotPath(0, config->getBasePath(), true, true));
 }
 
 /* Parse lock and attempt unlock */
@@ -1420,6 +1482,34 @@ void Game::pollEvents()
   event_handler.pollClear();
 }
 
+/* Reads back the captured snapshot and hands it to the worker to be encoded
+ * and written. Any previous write is finished first, so only one runs */
+void Game::readScreenshot(SDL_Renderer* renderer)
+{
+  int shot_w = 0;
+  int shot_h = 0;
+  shot_rendered = false;
+  SDL_QueryTexture(shot_target, nullptr, nullptr, &shot_w, &shot_h);
+
+  SDL_Surface* shot = SDL_CreateRGBSurface(0, shot_w, shot_h, 32, 0x00ff0000,
+                                           0x0000ff00, 0x000000ff, 0xff000000);
+  if(shot != nullptr)
+  {
+    SDL_Texture* orig_target = SDL_GetRenderTarget(renderer);
+    SDL_SetRenderTarget(renderer, shot_target);
+    SDL_RenderReadPixels(renderer, nullptr, SDL_PIXELFORMAT_ARGB8888,
+                         shot->pixels, shot->pitch);
+    SDL_SetRenderTarget(renderer, orig_target);
+
+    if(shot_job.valid())
+      shot_job.wait();
+    std::string path = shot_path;
+    shot_job = std::async(std::launch::async, [=]() {
+      return writeScreenshot(path, shot);
+    });
+  }
+}
+
 /* Remove functions for game objects */
 void Game::removeActions()
 {
@@ -1553,6 +1643,88 @@ void Game::removeSkillSets()
   list_set.clear();
 }
 
+/* Renders the map, capturing the snapshot from it if one is requested. For
+ * the capture, the map is rendered into the frame target instead of the
+ * screen, which is then drawn to the screen and scaled down into the shot
+ * target. The shot target is read back on the next frame, once the GPU is
+ * done with it, so the frame is never stalled on a read of the screen */
+bool Game::renderMap(SDL_Renderer* renderer)
+{
+  /* Finish the capture from the last frame */
+  if(shot_rendered)
+    readScreenshot(renderer);
+
+  if(!shot_requested || renderer == nullptr)
+    return map_ctrl.render(renderer);
+  shot_requested = false;
+
+  /* Create the targets. The frame target is the screen size and the shot
+   * target is the scaled snapshot rect. Each is only re-created if its size
+   * changes, as the snapshot rect does with the zoom and viewport */
+  int screen_w = 0;
+  int screen_h = 0;
+  int frame_w = 0;
+  int frame_h = 0;
+  SDL_GetRendererOutputSize(renderer, &screen_w, &screen_h);
+  if(shot_frame != nullptr)
+    SDL_QueryTexture(shot_frame, nullptr, nullptr, &frame_w, &frame_h);
+  if(shot_frame == nullptr || frame_w != screen_w || frame_h != screen_h)
+  {
+    if(shot_frame != nullptr)
+      SDL_DestroyTexture(shot_frame);
+
+    /* Linear, so the scale down into the shot target is smooth */
+    std::string scale_quality = "";
+    if(SDL_GetHint(SDL_HINT_RENDER_SCALE_QUALITY) != nullptr)
+      scale_quality = SDL_GetHint(SDL_HINT_RENDER_SCALE_QUALITY);
+    SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "1");
+    shot_frame = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888,
+                                   SDL_TEXTUREACCESS_TARGET, screen_w,
+                                   screen_h);
+    SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, scale_quality.c_str());
+  }
+  SDL_Rect shot_rect = map_ctrl.getSnapshotRect();
+  int target_w = std::max(shot_rect.w / kSAVE_IMG_SCALE, 1);
+  int target_h = std::max(shot_rect.h / kSAVE_IMG_SCALE, 1);
+  int shot_w = 0;
+  int shot_h = 0;
+  if(shot_target != nullptr)
+    SDL_QueryTexture(shot_target, nullptr, nullptr, &shot_w, &shot_h);
+  if(shot_target == nullptr || shot_w != target_w || shot_h != target_h)
+  {
+    if(shot_target != nullptr)
+      SDL_DestroyTexture(shot_target);
+    shot_target = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888,
+                                    SDL_TEXTUREACCESS_TARGET, target_w,
+                                    target_h);
+  }
+  if(shot_frame == nullptr || shot_target == nullptr)
+    return map_ctrl.render(renderer);
+
+  /* Render the map into the frame */
+  SDL_SetRenderTarget(renderer, shot_frame);
+  SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+  SDL_RenderClear(renderer);
+  bool success = map_ctrl.render(renderer);
+
+  /* Scale the snapshot down into the shot and draw the frame to the screen */
+  SDL_SetRenderTarget(renderer, shot_target);
+  SDL_RenderCopy(renderer, shot_frame, &shot_rect, nullptr);
+  SDL_SetRenderTarget(renderer, nullptr);
+  SDL_RenderCopy(renderer, shot_frame, nullptr, nullptr);
+  shot_rendered = true;
+
+  return success;
+}
+
+/* Requests a snapshot of the map to be written to the path. It is captured
+ * on the next map render */
+void Game::requestScreenshot(std::string path)
+{
+  shot_path = path;
+  shot_requested = !path.empty();
+}
+
 bool Game::setSaveSlot(uint8_t save_slot)
 {
   if(save_slot <= kSAVE_SLOT_MAX)
@@ -1621,11 +1793,10 @@ void Game::updateMenuSaving()
   auto save_index = map_menu.getSaveIndex();
   auto save_state = map_menu.getMenuSaveState();
 
+  /* The save titles refresh once the write finishes, in updateSaving() */
   if(save_state == MenuSaveState::WRITE)
   {
     save(save_index + 1, true);
-    map_menu.setSaveData(getSaveData());
-    map_menu.updateSaveTitles();
   }
   else if(save_state == MenuSaveState::CLEAR)
   {
@@ -1648,6 +1819,44 @@ void Game::updatePlayerSteps()
   }
 }
 
+/* Finishes the save running on the worker thread, once it is complete or
+ * right away if wait is set. Completion is reported as a notification. The
+ * slot image is captured a frame after the save, so unless waiting, this also
+ * holds off until the image is written for the save data to pick up */
+void Game::updateSaving(bool wait)
+{
+  bool shot_done = !shot_requested && !shot_rendered &&
+                   (!shot_job.valid() ||
+                    shot_job.wait_for(std::chrono::seconds(0)) ==
+                        std::future_status::ready);
+
+  if(save_job.valid() &&
+     (wait || (shot_done && save_job.wait_for(std::chrono::seconds(0)) ==
+                                std::future_status::ready)))
+  {
+    if(shot_job.valid())
+      shot_job.wait();
+
+    if(save_job.get())
+    {
+      event_handler.executeEvent(
+          EventSet::createEventNotification("Game saved."), nullptr);
+    }
+    else
+    {
+      event_handler.executeEvent(
+          EventSet::createEventNotification("Game save failed."), nullptr);
+
+      /* The sections were marked as saved - the next save writes them all */
+      if(save_handle.isAvailable())
+        save_handle.stop(true);
+    }
+
+    map_menu.setSaveData(getSaveData());
+    map_menu.updateSaveTitles();
+  }
+}
+
 /*============================================================================
  * PUBLIC FUNCTIONS
  *===========================================================================*/
@@ -2306,7 +2515,7 @@ bool Game::render(SDL_Renderer* renderer)
   /* -- MAP MODE -- */
   if(mode == MAP)
   {
-    success = map_ctrl.render(renderer);
+    success = renderMap(renderer);
   }
   /* -- BATTLE MODE -- */
   else if(mode == BATTLE)
@@ -2327,7 +2536,7 @@ bool Game::render(SDL_Renderer* renderer)
   }
   else if(mode == MENU)
   {
-    map_ctrl.render(renderer);
+    renderMap(renderer);
     map_menu.setRenderer(renderer);
     map_menu.render();
   }
@@ -2342,6 +2551,9 @@ bool Game::save(uint8_t slot, bool from_menu)
   {
     bool success = true;
 
+    /* Only one save is written at a time */
+    updateSaving(true);
+
     /* Get the proper save slot number and file name */
     if(slot == 0)
     {
@@ -2355,62 +2567,91 @@ bool Game::save(uint8_t slot, bool from_menu)
     std::string save_path = getSlotPath(slot, config->getBasePath());
     std::string save_path_img = getSlotPath(slot, config->getBasePath(), true);
 
-    /* If the slot is different, the old data needs to be copied */
+    /* If the slot is different, the old data needs to be copied, along with
+     * the map section files in place of the ones in the slot */
     if(slot != save_slot && save_slot > 0)
     {
-      std::string old_path = getSlotPath(save_slot, config->getBasePath());
+      std::string base_path = config->getBasePath();
+      std::string old_path = getSlotPath(save_slot, base_path);
       if(FileHandler::fileExists(old_path))
+      {
+        for(auto& slot_map : getSlotMaps(slot))
+          for(uint16_t i = 0; i < slot_map.second; i++)
+            FileHandler::fileDelete(
+                getSlotMapPath(slot, base_path, slot_map.first, i));
+
+        for(auto& slot_map : getSlotMaps(save_slot))
+          for(uint16_t i = 0; i < slot_map.second; i++)
+            success &= FileHandler::fileCopy(
+                getSlotMapPath(save_slot, base_path, slot_map.first, i),
+                getSlotMapPath(slot, base_path, slot_map.first, i), true);
+
         success &= FileHandler::fileCopy(old_path, save_path, true);
+      }
     }
 
-    /* Start file write */
+    /* Start file write. The document is kept between saves of the same slot
+     * so it is only parsed from the file once. No file is held open - the
+     * worker writes it out. The map sections are in their own files */
     if(save_handle.isAvailable() && save_handle.getFilename() != save_path)
       save_handle.stop(true);
-    if(!save_handle.isAvailable())
+    bool save_full = !save_handle.isAvailable();
+    if(save_full)
     {
       save_handle.setEncryptionEnabled(false);
       save_handle.setFilename(save_path);
       save_handle.setWriteEnabled(true);
       save_handle.setFileType(FileHandler::XML);
-      success &= save_handle.start(true);
+      success &= save_handle.startDocument();
     }
 
     /* If handle is ready to go, proceed */
     if(save_handle.isAvailable() && success)
     {
-      /* If from menu, use auto save image */
+      /* If from menu, use auto save image once it is written. Otherwise,
+       * capture the map on the next render */
+      std::string save_auto_img;
       if(from_menu)
       {
-        std::string save_auto_img = getSlotPath(0, config->getBasePath(), true, true);
-        if(FileHandler::fileExists(save_auto_img))
-          FileHandler::fileCopy(save_auto_img, save_path_img, true);
+        save_auto_img = getSlotPath(0, config->getBasePath(), true, true);
+        if(shot_job.valid())
+          shot_job.wait();
       }
-      /* Otherwise, generate it on the fly */
       else
       {
-        saveScreenshot(save_path_img, map_ctrl.getSnapshotRect(),
-                       active_renderer);
+        requestScreenshot(save_path_img);
       }
 
-      /* Setup the core data */
+      /* Setup the core data. The document was just read from the file, so
+       * the core is written in full. Otherwise, only the party members and
+       * inventories that changed since the last save are re-written */
       XmlData data_core;
       data_core.addElement("game");
       data_core.addElement("core");
-      save_handle.purgeElement(data_core, true);
+      if(save_full)
+        save_handle.purgeElement(data_core);
 
       /* Write the core data */
       if(player_main != nullptr)
       {
         /* Write player data which contains all other data related */
+        XmlData data_player(data_core);
+        data_player.addElement("player");
         updatePlayerSteps();
-        success &= player_main->saveData(&save_handle);
+        success &= player_main->saveData(&save_handle, data_player, save_full);
       }
 
       if(config)
       {
+        XmlData data_options(data_core);
+        data_options.addElement("options");
+        save_handle.removeElement(data_options, true);
         success &= config->saveData(&save_handle);
       }
 
+      /* The changed map sections, each written to its own file */
+      std::vector<std::pair<std::string, std::string>> save_sections;
+
       if(map_ctrl.isLoaded())
       {
         /* The current map index information */
@@ -2425,18 +2666,69 @@ bool Game::save(uint8_t slot, bool from_menu)
         data_map_curr.addDataOfType(map_ctrl.getName());
         save_handle.writeXmlDataSet(data_map_curr);
 
-        /* Setup the map data */
+        /* The number of section files for the map */
+        XmlData data_map_files(static_cast<int>(map_ctrl.getSectionCount()));
+        data_map_files.addElement("game");
+        data_map_files.addElement("mapfiles", "id", std::to_string(map_lvl));
+        save_handle.writeXmlDataSet(data_map_files);
+
+        /* Drop the map data from before the sections had their own files */
         XmlData data_map;
         data_map.addElement("game");
         data_map.addElement("map", "id", std::to_string(map_lvl));
-        save_handle.purgeElement(data_map, true);
+        save_handle.removeElement(data_map);
 
-        /* Write the map data */
-        success &= map_ctrl.saveData(&save_handle);
+        /* Write the map sections. The document was just read from the file,
+         * so all sections are written. Otherwise, only the sections that
+         * changed since the last save are written */
+        bool encryption = save_handle.isEncryptionEnabled();
+        for(auto& section : map_ctrl.getSaveSections(save_full))
+        {
+          std::string path = getSlotMapPath(slot, config->getBasePath(),
+                                            map_lvl, section);
+          FileHandler fh_section(path, true, true, encryption);
+          if(fh_section.startDocument(false))
+          {
+            success &= map_ctrl.saveData(&fh_section, data_map, section);
+            save_sections.push_back(
+                std::make_pair(path, fh_section.getXmlSnapshot()));
+            fh_section.stop(true);
+          }
+          else
+          {
+            success = false;
+          }
+        }
       }
 
-      /* Finish the file write */
-      save_handle.stop(!success);
+      /* Hand the snapshots of the documents to the worker to write out. The
+       * slot file, with the section count, is written last */
+      if(success)
+      {
+        std::string output = save_handle.getXmlSnapshot();
+        bool encryption = save_handle.isEncryptionEnabled();
+
+        save_job = std::async(std::launch::async, [=]() {
+          bool written = true;
+
+          if(!save_auto_img.empty() && FileHandler::fileExists(save_auto_img))
+            written &= FileHandler::fileCopy(save_auto_img, save_path_img,
+                                             true);
+
+          for(auto& section : save_sections)
+            written &= FileHandler::writeXmlSnapshot(section.first,
+                                                     section.second,
+                                                     encryption);
+          written &= FileHandler::writeXmlSnapshot(save_path, output,
+                                                   encryption);
+          return written;
+        });
+      }
+      else
+      {
+        shot_requested = false;
+        save_handle.stop(true);
+      }
     }
 
     /* If success, save slot */
@@ -2458,14 +2750,32 @@ bool Game::saveClear(uint8_t slot)
     std::string delete_path = getSlotPath(slot, config->getBasePath());
     if(FileHandler::fileExists(delete_path))
     {
-      /* Delete the path */
-      bool success = FileHandler::fileDelete(delete_path);
+      /* Delete the map section files, found from the path, then the path */
+      bool success = true;
+      for(auto& slot_map : getSlotMaps(slot))
+      {
+        for(uint16_t i = 0; i < slot_map.second; i++)
+        {
+          std::string map_path = getSlotMapPath(slot, config->getBasePath(),
+                                                slot_map.first, i);
+          if(FileHandler::fileExists(map_path))
+            success &= FileHandler::fileDelete(map_path);
+        }
+      }
+      success &= FileHandler::fileDelete(delete_path);
 
       /* Delete the image path, if it exists */
       std::string save_path = getSlotPath(slot, config->getBasePath(), true);
       if(FileHandler::fileExists(save_path))
         success &= FileHandler::fileDelete(save_path);
 
+      /* Delete the image from before the snapshots were PNG, if it exists */
+      std::string legacy_path =
+          save_path.substr(0, save_path.size() - kSAVE_IMG_BACK.size()) +
+          kSAVE_IMG_LEGACY;
+      if(FileHandler::fileExists(legacy_path))
+        success &= FileHandler::fileDelete(legacy_path);
+
       return success;
     }
   }
@@ -2591,6 +2901,8 @@ void Game::unloadCore()
   removeAll();
   loaded_core = false;
 
+  /* Let any save being written finish first */
+  updateSaving(true);
   if(save_handle.isAvailable())
     save_handle.stop(true);
 }
@@ -2613,6 +2925,7 @@ bool Game::update(int32_t cycle_time)
 
   updateMenuEnabledState();
   updateMenuSaving();
+  updateSaving();
 
   // event_handler.getKeyHandler().print(false, true);
 
@@ -2723,6 +3036,22 @@ bool Game::update(int32_t cycle_time)
  * PUBLIC STATIC FUNCTIONS
  *===========================================================================*/
 
+/* Static: Returns the save string of a map section file in the slot. These
+ * sit beside the slot file, named for the map level and section */
+std::string Game::getSlotMapPath(uint8_t slot, std::string base_path,
+                                 int level, uint16_t section)
+{
+  std::string save_path = getSlotPath(slot, base_path);
+
+  if(!save_path.empty())
+  {
+    save_path.erase(save_path.size() - kSAVE_PATH_BACK.size());
+    save_path += kSAVE_PATH_MAP + std::to_string(level) + "_" +
+                 std::to_string(section) + kSAVE_PATH_BACK;
+  }
+  return save_path;
+}
+
 /* Static: Returns the save string based on the slot number */
 std::string Game::getSlotPath(uint8_t slot, std::string base_path, bool image,
                               bool precall)
@@ -2755,25 +3084,19 @@ std::string Game::getSlotPath(uint8_t slot, std::string base_path, bool image,
   return save_path;
 }
 
-/* Saves screenshot of the current game as it stands - as a BMP */
-bool Game::saveScreenshot(std::string path, SDL_Rect rect,
-                          SDL_Renderer* renderer, uint8_t factor)
+/* Writes a captured screenshot as a PNG, then frees it. This does not touch
+ * the renderer, so it can be called off the main thread */
+bool Game::writeScreenshot(std::string path, SDL_Surface* shot)
 {
-  if(!path.empty() && renderer != nullptr && factor > 0)
+  bool success = false;
+
+  if(shot != nullptr)
   {
-    SDL_Surface* sshot = SDL_CreateRGBSurface(
-        0, rect.w, rect.h, 32, 0x00ff0000, 0x0000ff00, 0x000000ff, 0xff000000);
-    SDL_RenderReadPixels(renderer, &rect, SDL_PIXELFORMAT_ARGB8888,
-                         sshot->pixels, sshot->pitch);
-    SDL_Surface* sshot2 =
-        SDL_CreateRGBSurface(0, rect.w / factor, rect.h / factor, 32,
-                             0x00ff0000, 0x0000ff00, 0x000000ff, 0xff000000);
-    SDL_BlitScaled(sshot, nullptr, sshot2, nullptr);
-    SDL_SaveBMP(sshot2, path.c_str());
-    SDL_FreeSurface(sshot);
-    SDL_FreeSurface(sshot2);
+    if(!path.empty())
+      success = (IMG_SavePNG(shot, path.c_str()) == 0);
 
-    return true;
+    SDL_FreeSurface(shot);
   }
-  return false;
+
+  return success;
 }
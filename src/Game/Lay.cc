@@ -9,7 +9,9 @@
 * Notes
 * -----
 *
-* [1]:
+* [1]: The lay image wraps around at its offset. Rather than drawing a full
+*      screen copy for each neighbouring tile, the screen is split at the
+*      offset into at most four parts, which together fill the screen once.
 *
 * See .h file for TODOs
 ******************************************************************************/
@@ -36,7 +38,7 @@ Lay::Lay()
       error{Floatinate(0, 0)},
       flags{static_cast<LayState>(0)},
       lay_sprite{nullptr},
-      lay_tiles{},
+      offset{Coordinate(0, 0)},
       path{""},
       range_top_left{Coordinate(0, 0)},
       range_bot_right{Coordinate(0, 0)},
@@ -121,43 +123,6 @@ Lay::~Lay()
  * PRIVATE FUNCTIONS
  *============================================================================*/
 
-/*
- * Description: Creates a tiled lay given an enumerated index (NORTH_EAST,
- *              EAST, etc.). To create a lay, the path must be split to
- *              determine which Sprite constructor is to be called. This method
- *              assings the appropriate starting (x, y) for the given tiled lay.
- *
- * Inputs: LayIndex lay_index - enumerated index of tiled lay to create
- * Output: bool - true if the tiled lay was created successfully
- */
- void Lay::createTiledLay(LayIndex lay_index)
-{
-  Coordinate new_tile;
-
-  if(lay_index == LayIndex::NORTH_WEST)
-    new_tile = {-screen_size.x, -screen_size.y};
-  else if(lay_index == LayIndex::NORTH)
-    new_tile = {0, -screen_size.y};
-  else if(lay_index == LayIndex::NORTH_EAST)
-    new_tile = {screen_size.x, -screen_size.y};
-  else if(lay_index == LayIndex::WEST)
-    new_tile = {-screen_size.x, 0};
-  else if(lay_index == LayIndex::CENTRE)
-    new_tile = {0, 0};
-  else if(lay_index == LayIndex::EAST)
-    new_tile = {screen_size.x, 0};
-  else if(lay_index == LayIndex::SOUTH_WEST)
-    new_tile = {-screen_size.x, screen_size.y};
-  else if(lay_index == LayIndex::SOUTH)
-    new_tile = {0, screen_size.y};
-  else if(lay_index == LayIndex::SOUTH_EAST)
-    new_tile = {screen_size.x, screen_size.y};
-
-  lay_tiles.push_back(new_tile);
-}
-
-
-
 /*
  * Description: Determines whether a given range is valid within the lay
  *              RANGE_BOUND context.
@@ -178,36 +143,57 @@ bool Lay::isRangeValid()
 }
 
 /*
- * Description: Updates the location of the Lay by a shift_x and shift_y.
- *              Generally called either by a cycle time update or a float
- *              shift amount.
+ * Description: Renders one part of the wrapped lay. The source is given in
+ *              screen coordinates of the stretched image and is converted to
+ *              the coordinates of the current frame, which may be a different
+ *              size than the screen.
  *
- * Inputs: dist_x - the x-distance to shift the lay by
- *         disT_y - the y-distance to shift the lay by
- * Output: none
+ * Inputs: SDL_Renderer* renderer - the rendering engine reference
+ *         SDL_Rect dest - the screen rect to fill
+ *         int32_t src_x - the x offset into the stretched lay image
+ *         int32_t src_y - the y offset into the stretched lay image
+ * Output: bool - true if rendering was successful or the part is empty
  */
-void Lay::updateLocations(int32_t dist_x, int32_t dist_y)
+bool Lay::renderPart(SDL_Renderer* renderer, SDL_Rect dest, int32_t src_x,
+                     int32_t src_y)
 {
-  for(auto& lay_tile : lay_tiles)
+  Frame* frame = lay_sprite->getCurrent();
+
+  if(dest.w > 0 && dest.h > 0 && frame != nullptr)
   {
-    /* Wrap the left to horizontal tiles back to the beginning */
-    if((lay_tile.x + dist_x) > screen_size.x)
-      lay_tile.x -= screen_size.x * 2;
+    int32_t frame_w = frame->getWidth();
+    int32_t frame_h = frame->getHeight();
 
-    /* Wrap the bottom to vertical tiles back to the beginning */
-    if((lay_tile.y + dist_y) > screen_size.y)
-      lay_tile.y -= screen_size.y * 2;
+    SDL_Rect src;
+    src.x = src_x * frame_w / screen_size.x;
+    src.y = src_y * frame_h / screen_size.y;
+    src.w = std::max((src_x + dest.w) * frame_w / screen_size.x - src.x, 1);
+    src.h = std::max((src_y + dest.h) * frame_h / screen_size.y - src.y, 1);
 
-    /* Wrap the right to horizontal tiles back to the beginning */
-    if((lay_tile.x + dist_x) < -screen_size.x)
-      lay_tile.x += screen_size.x * 2;
+    lay_sprite->setSourceRect(src);
+    return lay_sprite->render(renderer, dest.x, dest.y, dest.w, dest.h);
+  }
 
-    /* Wrap the top to vertical tiles back to the beginning */
-    if((lay_tile.y + dist_y) < -screen_size.y)
-      lay_tile.y += screen_size.y * 2;
+  return true;
+}
 
-    lay_tile.x += dist_x;
-    lay_tile.y += dist_y;
+/*
+ * Description: Updates the wrapped offset of the Lay by a shift_x and shift_y.
+ *              Generally called either by a cycle time update or a float
+ *              shift amount. The offset stays within the screen size.
+ *
+ * Inputs: dist_x - the x-distance to shift the lay by
+ *         disT_y - the y-distance to shift the lay by
+ * Output: none
+ */
+void Lay::updateOffset(int32_t dist_x, int32_t dist_y)
+{
+  if(screen_size.x > 0 && screen_size.y > 0)
+  {
+    offset.x = ((offset.x + dist_x) % screen_size.x + screen_size.x) %
+               screen_size.x;
+    offset.y = ((offset.y + dist_y) % screen_size.y + screen_size.y) %
+               screen_size.y;
   }
 }
 
@@ -241,10 +227,8 @@ void Lay::createFromLayStruct(LayOver lay_data, SDL_Renderer* renderer)
 }
 
 /*
- * Description: Determines which lay tiles (NORTH_EAST, EAST, etc.) need to
- *              be created for the given velocity (x, y) floatinate. This
- *              method will call for the creation of the needed lays and
- *              return whether they were successfully constructed.
+ * Description: Creates the lay sprite from the path and resets the wrapped
+ *              offset of the lay, which is moved by the velocity on update.
  *
  * Inputs: none
  * Output: bool - true if the lays were created successfully
@@ -255,7 +239,7 @@ bool Lay::createTiledLays(SDL_Renderer* renderer)
   if(lay_sprite)
     delete lay_sprite;
   lay_sprite = nullptr;
-  lay_tiles.clear();
+  offset = Coordinate(0, 0);
 
   /* The sprite should not already be created */
   if(!lay_sprite && renderer && path != "")
@@ -279,26 +263,6 @@ bool Lay::createTiledLays(SDL_Renderer* renderer)
       lay_sprite->createTexture(renderer);
     }
 
-    createTiledLay(LayIndex::CENTRE);
-
-    if(velocity.x < 0)
-      createTiledLay(LayIndex::EAST);
-    if(velocity.x > 0)
-      createTiledLay(LayIndex::WEST);
-    if(velocity.y < 0)
-      createTiledLay(LayIndex::SOUTH);
-    if(velocity.y > 0)
-      createTiledLay(LayIndex::NORTH);
-
-    if(velocity.x > 0 && velocity.y > 0)
-      createTiledLay(LayIndex::NORTH_WEST);
-    else if(velocity.x > 0 && velocity.y < 0)
-      createTiledLay(LayIndex::SOUTH_WEST);
-    else if(velocity.x < 0 && velocity.y > 0)
-      createTiledLay(LayIndex::NORTH_EAST);
-    else if(velocity.x < 0 && velocity.y < 0)
-      createTiledLay(LayIndex::SOUTH_EAST);
-
     return true;
   }
 
@@ -330,7 +294,8 @@ Sprite* Lay::getLaySprite()
 /*
  * Description: Renders the lay at its given position. If the lay flag
  *              is set to screen_size, the configuration screen width will be
- *              used as the size to render the lay.
+ *              used as the size to render the lay. The image is wrapped at
+ *              the offset, filling the screen once (see Notes [1]).
  *
  * Inputs: none
  * Output: bool - true if rendering was successful
@@ -345,14 +310,20 @@ bool Lay::render(SDL_Renderer* renderer)
     if(lay_sprite == nullptr && path != "")
       createTiledLays(renderer);
 
-    /* Attempt render */
-    if(lay_sprite)
+    /* Attempt render, in the four parts split at the offset */
+    if(lay_sprite && screen_size.x > 0 && screen_size.y > 0)
     {
-      for(const auto& lay_tile : lay_tiles)
-      {
-        success &= lay_sprite->render(renderer, lay_tile.x, lay_tile.y,
-                                      screen_size.x, screen_size.y);
-      }
+      int32_t left_w = offset.x;
+      int32_t top_h = offset.y;
+      int32_t right_w = screen_size.x - offset.x;
+      int32_t bot_h = screen_size.y - offset.y;
+
+      success &= renderPart(renderer, {0, 0, left_w, top_h}, right_w, bot_h);
+      success &= renderPart(renderer, {left_w, 0, right_w, top_h}, 0, bot_h);
+      success &= renderPart(renderer, {0, top_h, left_w, bot_h}, right_w, 0);
+      success &= renderPart(renderer, {left_w, top_h, right_w, bot_h}, 0, 0);
+
+      lay_sprite->unsetSourceRect();
     }
   }
 
@@ -457,7 +428,7 @@ void Lay::setSpritePath(const std::string &path)
   if(lay_sprite)
     delete lay_sprite;
   lay_sprite = nullptr;
-  lay_tiles.clear();
+  offset = Coordinate(0, 0);
 
   /* Change path */
   this->path = path;
@@ -497,7 +468,7 @@ void Lay::shift(Floatinate shift)
     auto dist_x = std::floor(error.x);
     auto dist_y = std::floor(error.y);
 
-    updateLocations(dist_x, dist_y);
+    updateOffset(dist_x, dist_y);
 
     error.x -= dist_x;
     error.y -= dist_y;
@@ -524,7 +495,7 @@ void Lay::update(int32_t cycle_time)
     auto dist_x = std::floor(error.x);
     auto dist_y = std::floor(error.y);
 
-    updateLocations(dist_x, dist_y);
+    updateOffset(dist_x, dist_y);
 
     error.x -= dist_x;
     error.y -= dist_y;
@@ -19,6 +19,7 @@
  *     it at a tile and then walking in. More true animation. How to?
  ******************************************************************************/
 #include "Game/Map/Map.h"
+#include "Logger.h"
 
 /* Constant Implementation - see header file for descriptions */
 const float Map::kFADE_FACTOR = 4.0;
@@ -31,6 +32,11 @@ const uint8_t Map::kFILE_GAME_TYPE = 1;
 const uint8_t Map::kFILE_SECTION_ID = 2;
 const uint8_t Map::kFILE_TILE_COLUMN = 5;
 const uint8_t Map::kFILE_TILE_ROW = 4;
+const uint8_t Map::kLOD_BAKES = 4;
+const uint8_t Map::kLOD_CHUNK = 8;
+const uint16_t Map::kLOD_CHUNKS = 128;
+const uint8_t Map::kLOD_MARGIN = 1;
+const uint16_t Map::kLOD_TILE_SIZE = 32;
 const uint8_t Map::kMAX_U8BIT = 255;
 const uint32_t Map::kMUSIC_REPEAT = 300000; /* 5 minutes */
 const uint16_t Map::kNAME_DISPLAY = 5000;   /* 5 seconds */
@@ -39,8 +45,12 @@ const uint8_t Map::kNAME_SIZE = 48;
 const float Map::kNAME_X = 0.075;
 const float Map::kNAME_Y = 0.925;
 const uint8_t Map::kPLAYER_ID = 0;
+const uint8_t Map::kSTREAM_LOADS = 4;
+const uint8_t Map::kSTREAM_MARGIN = 8;
+const uint16_t Map::kSTREAM_SPRITES = 512;
 const uint16_t Map::kSNAPSHOT_W = 600;
 const uint16_t Map::kSNAPSHOT_H = 500;
+const float Map::kZOOM_RATE = 0.06;
 const uint16_t Map::kZOOM_TILE_SIZE = 16;
 
 /*============================================================================
@@ -51,6 +61,7 @@ const uint16_t Map::kZOOM_TILE_SIZE = 16;
 Map::Map(Options* running_config, EventHandler* event_handler)
 {
   /* Set initial variables */
+  animation_clock = 0;
   base_path = "";
   battle_eventlose = {nullptr, nullptr};
   battle_eventwin = {nullptr, nullptr};
@@ -70,6 +81,10 @@ Map::Map(Options* running_config, EventHandler* event_handler)
   lay_fade_index = -1;
   lay_time = -1;
   loaded = false;
+  lod_region = {0, 0, 0, 0};
+  lod_scratch = nullptr;
+  lod_section = 0;
+  lod_stamp = 0;
   map_index = 0;
   map_index_next = -1;
   mode_curr = DISABLED;
@@ -79,7 +94,12 @@ Map::Map(Options* running_config, EventHandler* event_handler)
   name = "Map Name";
   name_view = 0;
   player = nullptr;
+  player_x = 0;
+  player_y = 0;
   speed_factor = 1.0;
+  stream_region = {0, 0, 0, 0};
+  stream_section = 0;
+  stream_stamp = 0;
   system_options = nullptr;
   view_acc = 0;
   view_section = 0;
@@ -93,6 +113,7 @@ Map::Map(Options* running_config, EventHandler* event_handler)
   tile_height = Helpers::getTileSize();
   tile_width = tile_height;
   zooming = false;
+  zoom_curr = tile_height;
   zoom_size = tile_height;
   viewport.setTileSize(tile_width, tile_height);
 
@@ -147,6 +168,7 @@ bool Map::addSpriteData(XmlData data, std::string id, int file_index,
     {
       access_sprite = new Sprite();
       access_sprite->setId(access_id);
+      access_sprite->setAnimationClock(&animation_clock);
       tile_sprites.push_back(access_sprite);
 
       /* If the copy sprite isn't null, copy the data into the new sprite */
@@ -154,8 +176,14 @@ bool Map::addSpriteData(XmlData data, std::string id, int file_index,
         *access_sprite = *copy_sprite;
     }
 
+    /* When streaming, only the build data is stored until the sprite is
+     * near the viewport */
+    bool build_data = !(system_options != nullptr &&
+                        system_options->getFlag(OptionState::MAP_STREAMING));
+
     return access_sprite->addFileInformation(data, file_index, renderer,
-                                             base_game_path);
+                                             base_game_path, false,
+                                             build_data);
   }
 
   return false;
@@ -262,6 +290,10 @@ bool Map::addTileData(XmlData data, uint16_t section_index)
           /* Otherwise, it's a tile event */
           else
           {
+            /* Tile events are stored sparsely, created on first use */
+            sub_map[section_index].tiles[r][c]->setEvents(
+                &sub_map[section_index].tile_events[std::make_pair(r, c)]);
+
             /* Classify between enter and exit events */
             if(data.getKeyValue(kFILE_CLASSIFIER) == "enter" ||
                data.getKeyValue(kFILE_CLASSIFIER) == "enterset")
@@ -585,7 +617,7 @@ void Map::audioUpdate(bool sub_change)
       /* If different, update */
       if(new_id != music_id)
       {
-        std::cout << "   > Map Music Trigger ID: " << new_id << std::endl;
+        LOG_DEBUG(MAP, "   > Map Music Trigger ID: " << new_id);
         music_id = new_id;
         event_handler->triggerMusic(music_id);
       }
@@ -609,6 +641,105 @@ void Map::audioUpdate(bool sub_change)
   }
 }
 
+/* Bakes the low detail chunk at the index of the current section. Animated
+ * tiles are baked at their current frame and stay frozen in the chunk until
+ * it is released and baked again */
+bool Map::bakeLodChunk(SDL_Renderer* renderer, uint32_t index)
+{
+  auto& tiles = sub_map[map_index].tiles;
+  uint16_t chunks_y = (tiles.front().size() + kLOD_CHUNK - 1) / kLOD_CHUNK;
+  uint16_t x_start = (index / chunks_y) * kLOD_CHUNK;
+  uint16_t y_start = (index % chunks_y) * kLOD_CHUNK;
+  uint16_t x_end = std::min(static_cast<int>(tiles.size()),
+                            x_start + kLOD_CHUNK);
+  uint16_t y_end = std::min(static_cast<int>(tiles.front().size()),
+                            y_start + kLOD_CHUNK);
+  int size = kLOD_CHUNK * kLOD_TILE_SIZE;
+  bool success = true;
+
+  /* Marked baked up front, so a failed bake falls back instead of retrying */
+  MapLodChunk& chunk = lod_chunks[index];
+  chunk.baked = true;
+  chunk.stamp = lod_stamp;
+  lod_lru.push_front(index);
+  chunk.used = lod_lru.begin();
+
+  /* Each tile is painted at full size to the scratch, then copied down. The
+   * sprites may switch targets to composite, which resets any render scale */
+  if(lod_scratch == nullptr)
+  {
+    lod_scratch = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888,
+                                    SDL_TEXTUREACCESS_TARGET, tile_width,
+                                    tile_height);
+    if(lod_scratch == nullptr)
+      return false;
+    SDL_SetTextureBlendMode(lod_scratch, SDL_BLENDMODE_NONE);
+  }
+
+  /* Only bake an upper layer if a tile in the chunk has one */
+  bool has_upper = false;
+  for(uint16_t i = x_start; i < x_end && !has_upper; i++)
+    for(uint16_t j = y_start; j < y_end && !has_upper; j++)
+      has_upper = tiles[i][j]->isUpperSet();
+
+  uint8_t r, g, b, a;
+  SDL_GetRenderDrawColor(renderer, &r, &g, &b, &a);
+  SDL_Texture* orig_target = SDL_GetRenderTarget(renderer);
+
+  for(uint8_t layer = 0; layer < 2 && success; layer++)
+  {
+    bool upper = (layer > 0);
+    if(upper && !has_upper)
+      break;
+
+    SDL_Texture* baked = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888,
+                                           SDL_TEXTUREACCESS_TARGET, size,
+                                           size);
+    if(baked == nullptr)
+    {
+      success = false;
+      break;
+    }
+    SDL_SetTextureBlendMode(baked, SDL_BLENDMODE_BLEND);
+    SDL_SetRenderTarget(renderer, baked);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+    SDL_RenderClear(renderer);
+
+    for(uint16_t i = x_start; i < x_end; i++)
+    {
+      for(uint16_t j = y_start; j < y_end; j++)
+      {
+        Tile* ref_tile = tiles[i][j];
+
+        SDL_SetRenderTarget(renderer, lod_scratch);
+        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+        SDL_RenderClear(renderer);
+        if(upper)
+          success &= ref_tile->renderUpper(renderer, ref_tile->getPixelX(),
+                                           ref_tile->getPixelY());
+        else
+          success &= ref_tile->renderLower(renderer, ref_tile->getPixelX(),
+                                           ref_tile->getPixelY());
+
+        SDL_Rect dest = {(i - x_start) * kLOD_TILE_SIZE,
+                         (j - y_start) * kLOD_TILE_SIZE, kLOD_TILE_SIZE,
+                         kLOD_TILE_SIZE};
+        SDL_SetRenderTarget(renderer, baked);
+        SDL_RenderCopy(renderer, lod_scratch, nullptr, &dest);
+      }
+    }
+
+    if(upper)
+      chunk.upper = baked;
+    else
+      chunk.lower = baked;
+  }
+
+  SDL_SetRenderTarget(renderer, orig_target);
+  SDL_SetRenderDrawColor(renderer, r, g, b, a);
+  return success;
+}
+
 /* Change the mode that the game is running */
 bool Map::changeMode(MapMode mode)
 {
@@ -626,15 +757,15 @@ bool Map::changeMode(MapMode mode)
 
     /* PRINT - TEMPORARY */
     if(mode_next == DISABLED)
-      std::cout << "-MAP MODE: DISABLED" << std::endl;
+      LOG_DEBUG(MAP, "-MAP MODE: DISABLED");
     else if(mode_next == NORMAL)
-      std::cout << "-MAP MODE: NORMAL" << std::endl;
+      LOG_DEBUG(MAP, "-MAP MODE: NORMAL");
     else if(mode_next == SWITCHSUB)
-      std::cout << "-MAP MODE: SWITCH SUB" << std::endl;
+      LOG_DEBUG(MAP, "-MAP MODE: SWITCH SUB");
     else if(mode_next == VIEW)
-      std::cout << "-MAP MODE: VIEW" << std::endl;
+      LOG_DEBUG(MAP, "-MAP MODE: VIEW");
     else if(mode_next == NONE)
-      std::cout << "-MAP MODE: NONE" << std::endl;
+      LOG_DEBUG(MAP, "-MAP MODE: NONE");
 
     /* Changes to execute on the new modes - if relevant */
     // if(this->mode == MAP)
@@ -644,6 +775,34 @@ bool Map::changeMode(MapMode mode)
   return allow;
 }
 
+/* Releases the baked low detail chunks */
+void Map::clearLod()
+{
+  while(!lod_lru.empty())
+    clearLodChunk(lod_lru.back());
+  lod_chunks.clear();
+  lod_region = {0, 0, 0, 0};
+
+  if(lod_scratch != nullptr)
+    SDL_DestroyTexture(lod_scratch);
+  lod_scratch = nullptr;
+}
+
+/* Releases one baked low detail chunk, to be baked again if back in view */
+void Map::clearLodChunk(uint32_t index)
+{
+  MapLodChunk& chunk = lod_chunks[index];
+  if(chunk.baked)
+  {
+    if(chunk.lower != nullptr)
+      SDL_DestroyTexture(chunk.lower);
+    if(chunk.upper != nullptr)
+      SDL_DestroyTexture(chunk.upper);
+    lod_lru.erase(chunk.used);
+    chunk = {false, nullptr, nullptr, 0, lod_lru.end()};
+  }
+}
+
 /* Returns the color mode from the active set of data */
 ColorMode Map::getColorMode()
 {
@@ -951,6 +1110,7 @@ bool Map::initiateMapSection(uint16_t section_index, int width, int height)
     /* Create clear section */
     SubMap map_section;
     map_section.weather = -1;
+    map_section.dirty = true;
 
     /* Make sure the vector is of correct size first */
     while(sub_map.size() <= section_index)
@@ -1184,6 +1344,46 @@ bool Map::isColorTransitioning()
   return (mode == ColorMode::GREYING || mode == ColorMode::COLORING);
 }
 
+/* Returns if the map renders from the low detail chunks. The baked chunks
+ * hold a single color mode, so a transition renders tile by tile */
+bool Map::isLodActive()
+{
+  return (zoom_curr <= kLOD_TILE_SIZE && zoom_curr < tile_width &&
+          !isColorTransitioning() && sub_map.size() > map_index &&
+          !sub_map[map_index].tiles.empty());
+}
+
+/* Returns if the sub map has changed since it was last saved */
+bool Map::isSectionDirty(uint16_t section)
+{
+  if(section >= sub_map.size())
+    return false;
+  SubMap* sub = &sub_map[section];
+  if(sub->dirty)
+    return true;
+
+  /* Tile events */
+  for(auto& entry : sub->tile_events)
+    if(entry.second.enter.isDirty() || entry.second.exit.isDirty())
+      return true;
+
+  /* Things, IOs, items and persons */
+  for(auto& thing : sub->things)
+    if(thing->isDirty())
+      return true;
+  for(auto& io : sub->ios)
+    if(io->isDirty())
+      return true;
+  for(auto& item : sub->items)
+    if(item->isDirty())
+      return true;
+  for(auto& person : sub->persons)
+    if(person->isDirty())
+      return true;
+
+  return false;
+}
+
 /* Mode view update */
 bool Map::modeViewStart(int cycle_time, bool travel)
 {
@@ -1255,6 +1455,8 @@ MapThing* Map::moveThing(MapThing* thing_ref, uint16_t section_old)
     {
       SubMap* sub_old = &sub_map[section_old];
       SubMap* sub_new = &sub_map[section_new];
+      sub_old->dirty = true;
+      sub_new->dirty = true;
 
       /* Parse based on the thing descriptor */
       if(thing_ref->classDescriptor() == ThingBase::THING)
@@ -1318,6 +1520,9 @@ MapThing* Map::moveThing(MapThing* thing_ref, uint16_t section_old)
         /* Add the IO to the new array */
         sub_new->ios.push_back(static_cast<MapInteractiveObject*>(thing_ref));
       }
+
+      /* The thing is now tied to another section, re-evaluate on the tick */
+      wakeThing(thing_ref);
     }
 
     return thing_ref;
@@ -1356,6 +1561,93 @@ bool Map::parseCoordinateInfo(std::string row, std::string col, uint16_t index,
   return false;
 }
 
+/* Renders the things of a single render list entry at the given depth */
+void Map::renderEntry(SDL_Renderer* renderer, const MapRenderEntry& entry,
+                      uint8_t index, int x_offset, int y_offset)
+{
+  /* Persons moving east or south render from the previous tile frames */
+  if(entry.person != nullptr)
+  {
+    if(entry.person->getMovement() == Direction::EAST ||
+       entry.person->getMovement() == Direction::SOUTH)
+    {
+      entry.person->renderPrevious(renderer, entry.tile, index, x_offset,
+                                   y_offset);
+    }
+    else
+    {
+      entry.person->renderMain(renderer, entry.tile, index, x_offset,
+                               y_offset);
+    }
+  }
+
+  /* The base index things are rendered with the lower tiles */
+  if(index > 0)
+  {
+    if(entry.thing != nullptr)
+      entry.thing->renderMain(renderer, entry.tile, index, x_offset, y_offset);
+
+    if(entry.io != nullptr)
+      entry.io->renderMain(renderer, entry.tile, index, x_offset, y_offset);
+  }
+}
+
+/* Renders the lower or upper tiles in the viewport, from the low detail
+ * chunks where baked and tile by tile otherwise */
+bool Map::renderLod(SDL_Renderer* renderer, bool upper, int x_offset,
+                    int y_offset)
+{
+  auto& tiles = sub_map[map_index].tiles;
+  uint16_t chunks_y = (tiles.front().size() + kLOD_CHUNK - 1) / kLOD_CHUNK;
+  uint16_t tile_x_start = viewport.getXTileStart();
+  uint16_t tile_x_end = viewport.getXTileEnd();
+  uint16_t tile_y_start = viewport.getYTileStart();
+  uint16_t tile_y_end = viewport.getYTileEnd();
+  bool success = true;
+
+  for(uint16_t x = tile_x_start / kLOD_CHUNK; x * kLOD_CHUNK < tile_x_end; x++)
+  {
+    for(uint16_t y = tile_y_start / kLOD_CHUNK; y * kLOD_CHUNK < tile_y_end;
+        y++)
+    {
+      MapLodChunk& chunk = lod_chunks[x * chunks_y + y];
+      if(chunk.baked)
+      {
+        SDL_Texture* baked = upper ? chunk.upper : chunk.lower;
+        if(baked != nullptr)
+        {
+          SDL_Rect dest = {x * kLOD_CHUNK * tile_width - x_offset,
+                           y * kLOD_CHUNK * tile_height - y_offset,
+                           kLOD_CHUNK * tile_width, kLOD_CHUNK * tile_height};
+          success &= (SDL_RenderCopy(renderer, baked, nullptr, &dest) == 0);
+        }
+      }
+      /* Not baked yet - render the tiles of the chunk that are in view */
+      else
+      {
+        uint16_t i_end = std::min(tile_x_end, (uint16_t)((x + 1) * kLOD_CHUNK));
+        uint16_t j_end = std::min(tile_y_end, (uint16_t)((y + 1) * kLOD_CHUNK));
+        for(uint16_t i = std::max(tile_x_start, (uint16_t)(x * kLOD_CHUNK));
+            i < i_end; i++)
+        {
+          for(uint16_t j = std::max(tile_y_start, (uint16_t)(y * kLOD_CHUNK));
+              j < j_end; j++)
+          {
+            if(upper)
+              success &= tiles[i][j]->renderUpper(renderer, x_offset,
+                                                  y_offset);
+            else
+              success &= tiles[i][j]->renderLower(renderer, x_offset,
+                                                  y_offset);
+          }
+        }
+      }
+    }
+  }
+
+  return success;
+}
+
 /* Save the passed in sub map based on the map ID */
 bool Map::saveSubMap(FileHandler* fh, const uint32_t& id,
                      const std::string& wrapper, const bool& write_id)
@@ -1410,32 +1702,30 @@ bool Map::saveTiles(FileHandler* fh, SubMap* sub_map)
   std::vector<std::pair<uint32_t, std::vector<uint32_t>>> tile_enters;
   std::vector<std::pair<uint32_t, std::vector<uint32_t>>> tile_exits;
 
-  /* Loop through all sub-map tiles to determine which events should be saved */
-  for(uint32_t i = 0; i < sub_map->tiles.size(); i++)
+  /* Loop through the sub-map tile events to determine which events should be
+   * saved. The table is ordered by x then y */
+  for(auto& entry : sub_map->tile_events)
   {
-    std::vector<uint32_t> col_enter;
-    std::vector<uint32_t> col_exit;
+    uint32_t i = entry.first.first;
+    uint32_t j = entry.first.second;
 
-    for(uint32_t j = 0; j < sub_map->tiles[i].size(); j++)
+    /* Enter Event */
+    if(entry.second.enter.isDataToSave())
     {
-      /* Enter Event */
-      EventSet* event_enter = sub_map->tiles[i][j]->getEventEnter();
-      if(event_enter->isDataToSave())
-        col_enter.push_back(j);
-
-      /* Exit Event */
-      EventSet* event_exit = sub_map->tiles[i][j]->getEventExit();
-      if(event_exit->isDataToSave())
-        col_exit.push_back(j);
+      if(tile_enters.empty() || tile_enters.back().first != i)
+        tile_enters.push_back(
+            std::pair<uint32_t, std::vector<uint32_t>>(i, {}));
+      tile_enters.back().second.push_back(j);
     }
 
-    /* Push onto stack if relevant */
-    if(col_enter.size() > 0)
-      tile_enters.push_back(
-          std::pair<uint32_t, std::vector<uint32_t>>(i, col_enter));
-    if(col_exit.size() > 0)
-      tile_exits.push_back(
-          std::pair<uint32_t, std::vector<uint32_t>>(i, col_exit));
+    /* Exit Event */
+    if(entry.second.exit.isDataToSave())
+    {
+      if(tile_exits.empty() || tile_exits.back().first != i)
+        tile_exits.push_back(
+            std::pair<uint32_t, std::vector<uint32_t>>(i, {}));
+      tile_exits.back().second.push_back(j);
+    }
   }
 
   /* Write the changed enter events */
@@ -1470,10 +1760,11 @@ bool Map::saveTileSet(
       {
         uint32_t y = set[i].second[j];
         fh->writeXmlElement("y", "index", y);
+        TileEvents& events = sub_map->tile_events[std::make_pair(x, y)];
         if(enter)
-          success &= sub_map->tiles[x][y]->getEventEnter()->saveData(fh, "");
+          success &= events.enter.saveData(fh, "");
         else
-          success &= sub_map->tiles[x][y]->getEventExit()->saveData(fh, "");
+          success &= events.exit.saveData(fh, "");
         fh->writeXmlElementEnd();
       }
       fh->writeXmlElementEnd();
@@ -1521,6 +1812,9 @@ void Map::setColorMode(ColorMode mode)
     for(auto i = lay_unders.begin(); i != lay_unders.end(); i++)
       if((*i)->getLaySprite() != nullptr)
         (*i)->getLaySprite()->setColorMode(mode);
+
+    /* The baked chunks hold the old colors */
+    clearLod();
   }
 }
 
@@ -1557,6 +1851,9 @@ bool Map::setSectionIndexMode(int index_next)
       viewport.setMapSize(sub_map[index].tiles.size(),
                           sub_map[index].tiles[0].size(), map_index);
 
+      /* Things idle in the section are now on the active map */
+      wakeThings(map_index);
+
       /* Update the lay overs */
       initiateLayUpdate();
 
@@ -1624,6 +1921,18 @@ bool Map::setTiles(MapThing* ref)
   return false;
 }
 
+/* Puts the thing to sleep, if it is idle after its update */
+void Map::sleepThing(MapThing* thing, bool active_map)
+{
+  int sleep_time = thing->getSleepTime(active_map);
+  if(sleep_time != MapThing::kSLEEP_NONE)
+  {
+    thing->sleep(thing_timers.getClock(), active_map);
+    if(sleep_time != MapThing::kSLEEP_UNTIMED)
+      thing_timers.add(thing, sleep_time);
+  }
+}
+
 /* Splits the ID into a vector of IDs */
 std::vector<std::vector<int32_t>> Map::splitIdString(std::string id,
                                                      bool matrix)
@@ -1691,6 +2000,33 @@ std::vector<std::vector<int32_t>> Map::splitIdString(std::string id,
   return id_stack;
 }
 
+/* Marks the sprite as used in the current stream region */
+void Map::streamSprite(Sprite* sprite)
+{
+  if(sprite != nullptr)
+  {
+    bool fresh = true;
+
+    /* Move it to the front of the recently used list */
+    auto found = stream_lookup.find(sprite);
+    if(found != stream_lookup.end())
+    {
+      fresh = (found->second->second != stream_stamp);
+      found->second->second = stream_stamp;
+      stream_lru.splice(stream_lru.begin(), stream_lru, found->second);
+    }
+    else
+    {
+      stream_lru.emplace_front(sprite, stream_stamp);
+      stream_lookup[sprite] = stream_lru.begin();
+    }
+
+    /* Queue it to be built, once per region */
+    if(fresh && !sprite->isLoaded())
+      stream_queue.push_back(sprite);
+  }
+}
+
 /* Lay triggers based on passed in information */
 bool Map::triggerLay(std::string path, int anim_time, float velocity_x,
                      float velocity_y, int lay_time, bool force)
@@ -2083,6 +2419,83 @@ void Map::updateMode(int cycle_time)
   }
 }
 
+/* Sets up the low detail chunks of the section, bakes a few in view and
+ * releases the least recently used ones */
+bool Map::updateLod(SDL_Renderer* renderer)
+{
+  auto& tiles = sub_map[map_index].tiles;
+  int chunks_x = (tiles.size() + kLOD_CHUNK - 1) / kLOD_CHUNK;
+  int chunks_y = (tiles.front().size() + kLOD_CHUNK - 1) / kLOD_CHUNK;
+  bool success = true;
+
+  /* Chunks are laid out in columns, the same as the tiles */
+  if(lod_section != map_index || lod_chunks.empty())
+  {
+    clearLod();
+    lod_chunks.resize(chunks_x * chunks_y,
+                      {false, nullptr, nullptr, 0, lod_lru.end()});
+    lod_section = map_index;
+  }
+
+  /* The region is the chunks in view with a margin, bound to the section */
+  SDL_Rect region;
+  region.x = std::max(0, viewport.getXTileStart() / kLOD_CHUNK - kLOD_MARGIN);
+  region.y = std::max(0, viewport.getYTileStart() / kLOD_CHUNK - kLOD_MARGIN);
+  region.w = std::min(chunks_x, (viewport.getXTileEnd() + kLOD_CHUNK - 1) /
+                                    kLOD_CHUNK + kLOD_MARGIN) - region.x;
+  region.h = std::min(chunks_y, (viewport.getYTileEnd() + kLOD_CHUNK - 1) /
+                                    kLOD_CHUNK + kLOD_MARGIN) - region.y;
+
+  /* On a region change, mark the baked chunks within it as used */
+  if(region.x != lod_region.x || region.y != lod_region.y ||
+     region.w != lod_region.w || region.h != lod_region.h)
+  {
+    lod_region = region;
+    lod_stamp++;
+
+    for(int x = region.x; x < region.x + region.w; x++)
+    {
+      for(int y = region.y; y < region.y + region.h; y++)
+      {
+        MapLodChunk& chunk = lod_chunks[x * chunks_y + y];
+        if(chunk.baked)
+        {
+          chunk.stamp = lod_stamp;
+          lod_lru.splice(lod_lru.begin(), lod_lru, chunk.used);
+        }
+      }
+    }
+  }
+
+  /* Bake a few of the chunks in view each frame, so zooming does not hitch */
+  uint16_t tile_x_end = viewport.getXTileEnd();
+  uint16_t tile_y_end = viewport.getYTileEnd();
+  uint8_t bakes = 0;
+
+  for(uint16_t x = viewport.getXTileStart() / kLOD_CHUNK;
+      x * kLOD_CHUNK < tile_x_end && bakes < kLOD_BAKES; x++)
+  {
+    for(uint16_t y = viewport.getYTileStart() / kLOD_CHUNK;
+        y * kLOD_CHUNK < tile_y_end && bakes < kLOD_BAKES; y++)
+    {
+      if(!lod_chunks[x * chunks_y + y].baked)
+      {
+        success &= bakeLodChunk(renderer, x * chunks_y + y);
+        bakes++;
+      }
+    }
+  }
+
+  /* Release the least recently used chunks outside of the current region */
+  while(lod_lru.size() > kLOD_CHUNKS &&
+        lod_chunks[lod_lru.back()].stamp != lod_stamp)
+  {
+    clearLodChunk(lod_lru.back());
+  }
+
+  return success;
+}
+
 /* Update the player Run State */
 void Map::updatePlayerRunState(KeyHandler& key_handler)
 {
@@ -2097,69 +2510,143 @@ void Map::updatePlayerRunState(KeyHandler& key_handler)
   }
 }
 
-/* Updates the height and width, based on zoom factors */
-void Map::updateTileSize(bool force)
+/* Streams tile sprites in around the viewport and evicts unused ones */
+void Map::updateStream(SDL_Renderer* renderer)
 {
-  bool updated = false;
+  if(system_options == nullptr ||
+     !system_options->getFlag(OptionState::MAP_STREAMING) ||
+     sub_map.size() <= map_index || sub_map[map_index].tiles.empty())
+  {
+    return;
+  }
 
-  /* If force, changes directly to the size indicated */
-  if(force)
+  /* The region is the viewport with a margin, bound to the section */
+  auto& tiles = sub_map[map_index].tiles;
+  int width = tiles.size();
+  int height = tiles.front().size();
+  SDL_Rect region;
+  region.x = std::max(0, viewport.getXTileStart() - kSTREAM_MARGIN);
+  region.y = std::max(0, viewport.getYTileStart() - kSTREAM_MARGIN);
+  region.w = std::min(width, viewport.getXTileEnd() + kSTREAM_MARGIN) -
+             region.x;
+  region.h = std::min(height, viewport.getYTileEnd() + kSTREAM_MARGIN) -
+             region.y;
+
+  /* On a region change, mark all the sprites within it as used */
+  if(stream_section != map_index || region.x != stream_region.x ||
+     region.y != stream_region.y || region.w != stream_region.w ||
+     region.h != stream_region.h)
   {
-    tile_height = zoom_size;
-    tile_width = zoom_size;
-    zooming = false;
-    updated = true;
+    stream_queue.clear();
+    stream_region = region;
+    stream_section = map_index;
+    stream_stamp++;
+
+    for(int i = region.x; i < region.x + region.w; i++)
+    {
+      for(int j = region.y; j < region.y + region.h; j++)
+      {
+        Tile* ref_tile = tiles[i][j];
+
+        streamSprite(ref_tile->getBase());
+        streamSprite(ref_tile->getEnhancer());
+        for(auto& sprite : ref_tile->getLower())
+          streamSprite(sprite);
+        for(auto& sprite : ref_tile->getUpper())
+          streamSprite(sprite);
+      }
+    }
   }
-  /* Try and zoom in the map */
-  else if(tile_height < zoom_size && tile_width < zoom_size)
+
+  /* Build a few queued sprites each frame, so streaming does not hitch.
+   * Any in view but not yet built are built by the sprite on render */
+  for(uint8_t loads = 0; loads < kSTREAM_LOADS && !stream_queue.empty();)
   {
-    tile_height++;
-    tile_width = tile_height;
-    zooming = true;
-    updated = true;
+    Sprite* sprite = stream_queue.back();
+    stream_queue.pop_back();
+
+    if(!sprite->isLoaded())
+    {
+      sprite->loadData(renderer);
+      loads++;
+    }
   }
-  /* Try and zoom out the map */
-  else if(tile_height > zoom_size && tile_width > zoom_size)
+
+  /* Evict the least recently used sprites outside of the current region */
+  while(stream_lru.size() > kSTREAM_SPRITES &&
+        stream_lru.back().second != stream_stamp)
   {
-    tile_height--;
-    tile_width = tile_height;
-    zooming = true;
-    updated = true;
+    stream_lru.back().first->unloadData();
+    stream_lookup.erase(stream_lru.back().first);
+    stream_lru.pop_back();
   }
+}
 
-  /* Check zooming status */
-  if(zooming)
+/* Updates the viewport size to cover the screen at the current zoom */
+void Map::updateViewportSize()
+{
+  if(system_options != nullptr)
   {
-    if(tile_height == zoom_size || tile_width == zoom_size)
-    {
-      zooming = false;
-      // viewport.setTravelForce(false);
-    }
-    else
-    {
-      // viewport.setTravelForce(true);
-      // viewport.setToTravel(true);
-    }
+    float scale = zoom_curr / tile_width;
+    viewport.setSize(std::ceil(system_options->getScreenWidth() / scale),
+                     std::ceil(system_options->getScreenHeight() / scale));
   }
+}
 
-  /* If updated, update the height and width everywhere */
-  if(updated)
+/* Moves the current zoom towards the zoom size. Only the render scale and the
+ * viewport size change, the tiles keep their size */
+void Map::updateZoom(int cycle_time, bool force)
+{
+  float zoom_prev = zoom_curr;
+
+  /* If force, changes directly to the size indicated */
+  if(force)
+    zoom_curr = zoom_size;
+  /* Try and zoom in the map */
+  else if(zoom_curr < zoom_size)
+    zoom_curr = std::min(static_cast<float>(zoom_size),
+                         zoom_curr + kZOOM_RATE * cycle_time);
+  /* Try and zoom out the map */
+  else if(zoom_curr > zoom_size)
+    zoom_curr = std::max(static_cast<float>(zoom_size),
+                         zoom_curr - kZOOM_RATE * cycle_time);
+
+  zooming = (zoom_curr != zoom_size);
+
+  /* If updated, the viewport covers a different area of the map */
+  if(zoom_curr != zoom_prev)
   {
-    /* Update map tiles */
-    for(uint16_t i = 0; i < sub_map.size(); i++)
+    updateViewportSize();
+
+    /* Release the low detail chunks once zoomed back in */
+    if(!lod_chunks.empty() && !isLodActive())
+      clearLod();
+  }
+}
+
+/* Wakes the sleeping thing, crediting the time it slept for */
+void Map::wakeThing(MapThing* thing)
+{
+  if(thing != nullptr && thing->isSleeping())
+    thing->wake(thing_timers.getClock() - thing->getSleepClock());
+}
+
+/* Wakes the sleeping things of one section or all sections (section < 0) */
+void Map::wakeThings(int section)
+{
+  for(uint32_t i = 0; i < sub_map.size(); i++)
+  {
+    if(section < 0 || static_cast<uint32_t>(section) == i)
     {
-      for(uint16_t j = 0; j < sub_map[i].tiles.size(); j++)
-      {
-        for(uint16_t k = 0; k < sub_map[i].tiles[j].size(); k++)
-        {
-          sub_map[i].tiles[j][k]->setHeight(tile_height);
-          sub_map[i].tiles[j][k]->setWidth(tile_width);
-        }
-      }
+      for(auto& io : sub_map[i].ios)
+        wakeThing(io);
+      for(auto& item : sub_map[i].items)
+        wakeThing(item);
+      for(auto& person : sub_map[i].persons)
+        wakeThing(person);
+      for(auto& thing : sub_map[i].things)
+        wakeThing(thing);
     }
-
-    /* Update viewport */
-    viewport.setTileSize(tile_width, tile_height);
   }
 }
 
@@ -2170,7 +2657,7 @@ void Map::zoom(uint16_t tile_size, bool force)
   {
     zoom_size = tile_size;
     if(force)
-      updateTileSize(force);
+      updateZoom(0, force);
   }
 }
 
@@ -2179,7 +2666,7 @@ void Map::zoomRestore(bool force)
 {
   zoom_size = Helpers::getTileSize();
   if(force)
-    updateTileSize(force);
+    updateZoom(0, force);
 }
 
 /*============================================================================
@@ -2200,6 +2687,8 @@ void Map::battleLose()
                                        battle_eventlose.inst, battle_person,
                                        battle_thing);
         battle_eventlose.inst->has_exec = true;
+        if(battle_thing != nullptr)
+          battle_thing->setDirty();
       }
     }
   }
@@ -2233,6 +2722,8 @@ void Map::battleWon()
       event_handler->executeEventRef(battle_eventwin.base, battle_eventwin.inst,
                                      battle_person, battle_thing);
       battle_eventwin.inst->has_exec = true;
+      if(battle_thing != nullptr)
+        battle_thing->setDirty();
     }
   }
 
@@ -2494,27 +2985,52 @@ uint32_t Map::getPlayerSteps()
   return steps;
 }
 
+/* Returns the sections that changed since the last save, or all sections if
+ * full. The respawn counts of sleeping things are brought up to date first */
+std::vector<uint16_t> Map::getSaveSections(bool full)
+{
+  std::vector<uint16_t> sections;
+
+  wakeThings();
+  for(uint16_t i = 0; i < sub_map.size(); i++)
+    if(full || isSectionDirty(i))
+      sections.push_back(i);
+
+  return sections;
+}
+
+/* Returns the number of sections in the map, including the main section */
+uint16_t Map::getSectionCount()
+{
+  return sub_map.size();
+}
+
 /* Returns the rect (in pixels) snapshot of the map viewport - ideally player */
 SDL_Rect Map::getSnapshotRect()
 {
   SDL_Rect rect = {0, 0, kSNAPSHOT_W, kSNAPSHOT_H};
   if(player != nullptr)
   {
+    /* The viewport is in map pixels, the snapshot is in screen pixels */
+    float scale = zoom_curr / tile_width;
+    int view_height = viewport.getHeight() * scale;
+    int view_width = viewport.getWidth() * scale;
+
     /* X coordinate */
-    rect.x = player->getCenterX() - static_cast<int>(viewport.getX()) -
+    rect.x = (player->getCenterX() - viewport.getX()) * scale -
              (kSNAPSHOT_W / 2);
     if(rect.x < 0)
       rect.x = 0;
-    else if((rect.x + rect.w) >= viewport.getWidth())
-      rect.x = viewport.getWidth() - rect.w - 1;
+    else if((rect.x + rect.w) >= view_width)
+      rect.x = view_width - rect.w - 1;
 
     /* Y coordinate */
-    rect.y = player->getCenterY() - static_cast<int>(viewport.getY()) -
+    rect.y = (player->getCenterY() - viewport.getY()) * scale -
              (kSNAPSHOT_H / 2);
     if(rect.y < 0)
       rect.y = 0;
-    else if((rect.y + rect.h) >= viewport.getHeight())
-      rect.y = viewport.getHeight() - rect.h - 1;
+    else if((rect.y + rect.h) >= view_height)
+      rect.y = view_height - rect.h - 1;
   }
 
   return rect;
@@ -2898,12 +3414,11 @@ void Map::keyTestDownEvent(SDL_KeyboardEvent event)
         SDL_Rect bbox = player->getBoundingBox();
         SDL_Rect bpixel = player->getBoundingPixels();
 
-        std::cout << "----" << std::endl;
-        std::cout << "Location X: " << bbox.x << " - " << bpixel.x << std::endl;
-        std::cout << "Location Y: " << bbox.y << " - " << bpixel.y << std::endl;
-        std::cout << "Width: " << bbox.w << " - " << bpixel.w << std::endl;
-        std::cout << "Height: " << bbox.h << " - " << bpixel.h << std::endl;
-        std::cout << "----" << std::endl;
+        LOG_INFO(MAP, "----\nLocation X: " << bbox.x << " - " << bpixel.x
+                          << "\nLocation Y: " << bbox.y << " - " << bpixel.y
+                          << "\nWidth: " << bbox.w << " - " << bpixel.w
+                          << "\nHeight: " << bbox.h << " - " << bpixel.h
+                          << "\n----");
       }
     }
   }
@@ -3337,132 +3852,108 @@ bool Map::render(SDL_Renderer* renderer)
     float x_offset = viewport.getX();
     float y_offset = viewport.getY();
 
+    /* Stream in the tile sprites around the viewport */
+    updateStream(renderer);
+
+    /* When zoomed out, the tile layers render from the low detail chunks.
+     * Baking switches targets, so it happens before the map scale is set */
+    bool lod = isLodActive();
+    if(lod)
+      success &= updateLod(renderer);
+
     /* Underlay for map */
     for(auto it = lay_unders.begin(); it != end(lay_unders); ++it)
       if(*it)
         (*it)->render(renderer);
 
-    /* Render the lower tiles within the range of the viewport */
+    /* The map itself renders at the zoom scale, in unzoomed tile pixels */
+    float scale = zoom_curr / tile_width;
+    if(scale != 1.0)
+      SDL_RenderSetScale(renderer, scale, scale);
+
+    /* Reset the render list buckets - the storage is kept between frames */
+    if(render_list.size() < Helpers::getRenderDepth())
+      render_list.resize(Helpers::getRenderDepth());
+    for(auto& bucket : render_list)
+      bucket.clear();
+
+    /* The lower tiles from the low detail chunks */
+    if(lod)
+      success &= renderLod(renderer, false, x_offset, y_offset);
+
+    /* Single pass through the viewport. Lower sprites, items and the base
+     * things render immediately while the things on each render depth are
+     * gathered into the render list */
+    auto& tiles = sub_map[map_index].tiles;
     for(uint16_t i = tile_x_start; i < tile_x_end; i++)
     {
       for(uint16_t j = tile_y_start; j < tile_y_end; j++)
       {
-        Tile* ref_tile = sub_map[map_index].tiles[i][j];
+        Tile* ref_tile = tiles[i][j];
 
         /* Lower sprites */
-        ref_tile->renderLower(renderer, x_offset, y_offset);
+        if(!lod)
+          ref_tile->renderLower(renderer, x_offset, y_offset);
 
-        /* Map Items, if relevant */
-        if(ref_tile->isItemsSet())
+        /* Map Items, if relevant. Only the top item with a count renders */
+        for(auto& render_item : ref_tile->getItems())
         {
-          std::vector<MapItem*> item_set = ref_tile->getItems();
-          bool found = false;
-
-          for(uint16_t i = 0; !found && (i < item_set.size()); i++)
+          if(render_item->getCount() > 0)
           {
-            if(item_set[i]->getCount() > 0)
-            {
-              item_set[i]->render(renderer, x_offset, y_offset);
-              found = true;
-            }
+            render_item->render(renderer, x_offset, y_offset);
+            break;
           }
         }
 
         /* Base map thing, if relevant */
-        MapThing* render_thing = sub_map[map_index].tiles[i][j]->getThing(0);
+        MapThing* render_thing = ref_tile->getThing(0);
         if(render_thing != nullptr)
-          render_thing->renderMain(renderer, sub_map[map_index].tiles[i][j], 0,
-                                   x_offset, y_offset);
+          render_thing->renderMain(renderer, ref_tile, 0, x_offset, y_offset);
 
         /* Base map IO, if relevant */
-        MapInteractiveObject* render_io =
-            sub_map[map_index].tiles[i][j]->getIO(0);
+        MapInteractiveObject* render_io = ref_tile->getIO(0);
         if(render_io != nullptr)
-          render_io->renderMain(renderer, sub_map[map_index].tiles[i][j], 0,
-                                x_offset, y_offset);
+          render_io->renderMain(renderer, ref_tile, 0, x_offset, y_offset);
+
+        /* Gather the things on each render depth the tile holds */
+        uint16_t depth = ref_tile->getMaxRenderLevel();
+        if(depth > render_list.size())
+          depth = render_list.size();
+
+        for(uint8_t index = 0; index < depth; index++)
+        {
+          MapRenderEntry entry{ref_tile, nullptr, nullptr, nullptr};
+          if(ref_tile->getRenderThings(index, entry.person, entry.thing,
+                                       entry.io))
+            render_list[index].push_back(entry);
+        }
       }
     }
 
-    /* Render the map things within the range of the viewport */
-    for(uint8_t index = 0; index < Helpers::getRenderDepth(); index++)
+    /* Render the map things by depth, in viewport order within each depth */
+    for(uint8_t index = 0; index < render_list.size(); index++)
+      for(auto& entry : render_list[index])
+        renderEntry(renderer, entry, index, x_offset, y_offset);
+
+    /* Render the upper tiles within the range of the viewport */
+    if(lod)
+    {
+      success &= renderLod(renderer, true, x_offset, y_offset);
+    }
+    else
     {
       for(uint16_t i = tile_x_start; i < tile_x_end; i++)
       {
         for(uint16_t j = tile_y_start; j < tile_y_end; j++)
         {
-          MapInteractiveObject* render_io = nullptr;
-          MapPerson* render_person = nullptr;
-          MapThing* render_thing = nullptr;
-
-          /* Acquire render things and continue forward if some are not null
-           */
-          if(sub_map[map_index].tiles[i][j]->getRenderThings(
-                 index, render_person, render_thing, render_io))
-          {
-            /* Different indexes result in different rendering procedures
-             * If base index, render order is top item, thing, then person */
-            if(index == 0)
-            {
-              if(render_person != nullptr)
-              {
-                if(render_person->getMovement() == Direction::EAST ||
-                   render_person->getMovement() == Direction::SOUTH)
-                {
-                  render_person->renderPrevious(renderer,
-                                                sub_map[map_index].tiles[i][j],
-                                                index, x_offset, y_offset);
-                }
-                else
-                {
-                  render_person->renderMain(renderer,
-                                            sub_map[map_index].tiles[i][j],
-                                            index, x_offset, y_offset);
-                }
-              }
-            }
-            /* Otherwise, render order is person, then thing */
-            else
-            {
-              if(render_person != nullptr)
-              {
-                if(render_person->getMovement() == Direction::EAST ||
-                   render_person->getMovement() == Direction::SOUTH)
-                {
-                  render_person->renderPrevious(renderer,
-                                                sub_map[map_index].tiles[i][j],
-                                                index, x_offset, y_offset);
-                }
-                else
-                {
-                  render_person->renderMain(renderer,
-                                            sub_map[map_index].tiles[i][j],
-                                            index, x_offset, y_offset);
-                }
-              }
-
-              if(render_thing != nullptr)
-                render_thing->renderMain(renderer,
-                                         sub_map[map_index].tiles[i][j], index,
-                                         x_offset, y_offset);
-
-              if(render_io != nullptr)
-                render_io->renderMain(renderer, sub_map[map_index].tiles[i][j],
-                                      index, x_offset, y_offset);
-            }
-          }
+          sub_map[map_index].tiles[i][j]->renderUpper(renderer, x_offset,
+                                                      y_offset);
         }
       }
     }
 
-    /* Render the upper tiles within the range of the viewport */
-    for(uint16_t i = tile_x_start; i < tile_x_end; i++)
-    {
-      for(uint16_t j = tile_y_start; j < tile_y_end; j++)
-      {
-        sub_map[map_index].tiles[i][j]->renderUpper(renderer, x_offset,
-                                                    y_offset);
-      }
-    }
+    if(scale != 1.0)
+      SDL_RenderSetScale(renderer, 1.0, 1.0);
 
     /* Overlay for map */
     for(auto it = lay_overs.begin(); it != lay_overs.end(); ++it)
@@ -3509,20 +4000,48 @@ void Map::resetPlayerSteps()
     player->resetStepCount();
 }
 
-/* Saves the current map data to the active file handling pointer location */
-bool Map::saveData(FileHandler* fh)
+/* Saves the map section under the map element in the file, in place of any
+ * existing data for it. The section dirty status is cleared once written. Call
+ * getSaveSections() first for the sections to save */
+bool Map::saveData(FileHandler* fh, XmlData data_map, uint16_t section)
 {
-  if(fh != nullptr)
+  if(fh != nullptr && section < sub_map.size())
   {
     bool success = true;
 
-    /* Loop through and save all sub-maps */
-    for(uint32_t i = 0; i < sub_map.size(); i++)
+    XmlData data_section(data_map);
+    if(section == 0)
+      data_section.addElement("main");
+    else
+      data_section.addElement("section", "id", std::to_string(section));
+
+    if(fh->purgeElement(data_section, true) != nullptr)
     {
-      if(i == 0)
-        success &= saveSubMap(fh, i, "main", false);
-      else
-        success &= saveSubMap(fh, i);
+      success &= saveSubMap(fh, section, "", false);
+
+      /* Clear the dirty status now that the section is written */
+      if(success)
+      {
+        SubMap* sub = &sub_map[section];
+        sub->dirty = false;
+        for(auto& entry : sub->tile_events)
+        {
+          entry.second.enter.setDirty(false);
+          entry.second.exit.setDirty(false);
+        }
+        for(auto& thing : sub->things)
+          thing->setDirty(false);
+        for(auto& io : sub->ios)
+          io->setDirty(false);
+        for(auto& item : sub->items)
+          item->setDirty(false);
+        for(auto& person : sub->persons)
+          person->setDirty(false);
+      }
+    }
+    else
+    {
+      success = false;
     }
 
     return success;
@@ -3539,6 +4058,10 @@ bool Map::setBaseItems(std::vector<ItemData> items, SDL_Renderer* renderer)
   /* The connected base items in map */
   if(renderer != nullptr)
   {
+    /* Wake everything and drop the timers, which may refer to the items */
+    wakeThings();
+    thing_timers.clear();
+
     /* Delete the instance items */
     for(uint32_t i = 0; i < sub_map.size(); i++)
     {
@@ -3584,8 +4107,7 @@ bool Map::setConfiguration(Options* running_config)
     base_path = system_options->getBasePath();
 
     /* Update the viewport information */
-    viewport.setSize(running_config->getScreenWidth(),
-                     running_config->getScreenHeight());
+    updateViewportSize();
 
     /* Update font for name */
     if(!running_config->getFont(2).empty())
@@ -3692,6 +4214,7 @@ void Map::unfocus()
 void Map::unloadMap()
 {
   /* Reset the index and applicable parameters */
+  animation_clock = 0;
   battle_eventlose = {nullptr, nullptr};
   battle_eventwin = {nullptr, nullptr};
   battle_flags = BattleFlags::NONE;
@@ -3700,6 +4223,7 @@ void Map::unloadMap()
   battle_thing = nullptr;
   battle_trigger = false;
   color_mode = ColorMode::COLOR;
+  clearLod();
   map_index = 0;
   // map_dialog = MapDialog();
   // map_dialog.setEventHandler
@@ -3707,6 +4231,8 @@ void Map::unloadMap()
   name_text.unsetTexture();
   name_view = 0;
   player = nullptr;
+  player_x = 0;
+  player_y = 0;
   tile_height = Helpers::getTileSize();
   tile_width = tile_height;
 
@@ -3718,6 +4244,15 @@ void Map::unloadMap()
   viewport.triggerVibrationFinish(true);
   zoomRestore(true);
 
+  /* Drop all wake up timers for the things about to be deleted */
+  thing_timers.clear();
+
+  /* Drop the streaming state for the sprites about to be deleted */
+  stream_lookup.clear();
+  stream_lru.clear();
+  stream_queue.clear();
+  stream_region = {0, 0, 0, 0};
+
   /* Delete all sub-maps and data within */
   for(uint32_t i = 0; i < sub_map.size(); i++)
   {
@@ -3953,9 +4488,13 @@ bool Map::update(int cycle_time)
     map_dialog.setNotificationThings(getThingData(list));
   }
 
-  /* Update the sprite animation */
-  for(uint16_t i = 0; i < tile_sprites.size(); i++)
-    tile_sprites[i]->update(cycle_time);
+  /* Advance the sprite animation clock. Tile sprite frames are computed
+   * from it when rendered, so only color transitions need the full set */
+  if(cycle_time > 0)
+    animation_clock += cycle_time;
+  if(isColorTransitioning())
+    for(uint16_t i = 0; i < tile_sprites.size(); i++)
+      tile_sprites[i]->update(cycle_time, false, true);
 
   /* Update the base things */
   for(uint32_t i = 0; i < base_ios.size(); i++)
@@ -3967,22 +4506,65 @@ bool Map::update(int cycle_time)
   for(uint32_t i = 0; i < base_things.size(); i++)
     base_things[i]->update(cycle_time, tile_set);
 
-  /* Update the sub-map information */
+  /* Wake the sleeping things whose timers have fired. Stale entries, for
+   * things woken some other way since, are skipped */
+  thing_timers_fired.clear();
+  thing_timers.update(cycle_time, thing_timers_fired);
+  for(auto& entry : thing_timers_fired)
+  {
+    if(entry.thing->isSleeping() &&
+       entry.thing->getSleepClock() == entry.sleep_clock)
+    {
+      /* This ticks cycle time is credited by the update below */
+      int lapsed = thing_timers.getClock() - entry.sleep_clock - cycle_time;
+      entry.thing->wake(lapsed);
+    }
+  }
+
+  /* Sleeping npcs do not watch the player. Once it steps to another tile,
+   * wake the ones it has come into tracking range of */
+  if(player != nullptr && player->isTilesSet() && map_index < sub_map.size() &&
+     (player->getTileX() != player_x || player->getTileY() != player_y))
+  {
+    player_x = player->getTileX();
+    player_y = player->getTileY();
+    for(auto& person : sub_map[map_index].persons)
+      if(person->isSleeping() && person->classDescriptor() == ThingBase::NPC &&
+         static_cast<MapNPC*>(person)->isPlayerInTrackRange())
+        wakeThing(person);
+  }
+
+  /* Update the sub-map information. Sleeping things are skipped */
   for(uint32_t i = 0; i < sub_map.size(); i++)
   {
     bool active_map = (i == map_index);
 
     /* Update map interactive objects */
     for(uint32_t j = 0; j < sub_map[i].ios.size(); j++)
-      sub_map[i].ios[j]->update(cycle_time, tile_set, active_map);
+    {
+      if(!sub_map[i].ios[j]->isSleeping())
+      {
+        sub_map[i].ios[j]->update(cycle_time, tile_set, active_map);
+        sleepThing(sub_map[i].ios[j], active_map);
+      }
+    }
 
     /* Update map items */
     for(uint32_t j = 0; j < sub_map[i].items.size(); j++)
-      sub_map[i].items[j]->update(cycle_time, tile_set, active_map);
+    {
+      if(!sub_map[i].items[j]->isSleeping())
+      {
+        sub_map[i].items[j]->update(cycle_time, tile_set, active_map);
+        sleepThing(sub_map[i].items[j], active_map);
+      }
+    }
 
     /* Update persons for movement and animation */
     for(uint32_t j = 0; j < sub_map[i].persons.size(); j++)
     {
+      if(sub_map[i].persons[j]->isSleeping())
+        continue;
+
       tile_set.clear();
 
       /* Tile set for movement */
@@ -4001,14 +4583,27 @@ bool Map::update(int cycle_time)
       Floatinate person_move =
           sub_map[i].persons[j]->update(cycle_time, tile_set, active_map);
 
-      /* If player, record and store move distance */
-      if(sub_map[i].persons[j] == player && active_map)
-        player_move = {person_move.x, person_move.y};
+      /* If player, record and store move distance. The player never sleeps */
+      if(sub_map[i].persons[j] == player)
+      {
+        if(active_map)
+          player_move = {person_move.x, person_move.y};
+      }
+      else
+      {
+        sleepThing(sub_map[i].persons[j], active_map);
+      }
     }
 
     /* Update map things */
     for(uint32_t j = 0; j < sub_map[i].things.size(); j++)
-      sub_map[i].things[j]->update(cycle_time, tile_set, active_map);
+    {
+      if(!sub_map[i].things[j]->isSleeping())
+      {
+        sub_map[i].things[j]->update(cycle_time, tile_set, active_map);
+        sleepThing(sub_map[i].things[j], active_map);
+      }
+    }
   }
 
   /* If conversation is active, confirm that player is not moving */
@@ -4090,7 +4685,7 @@ bool Map::update(int cycle_time)
   item_menu.update(cycle_time);
   map_dialog.update(cycle_time);
   updateMode(cycle_time);
-  updateTileSize();
+  updateZoom(cycle_time);
   viewport.update(cycle_time);
 
   return false;
@@ -34,6 +34,7 @@ const uint8_t MapDialog::kHIGHLIGHT_MARGIN = 5;
 const uint16_t MapDialog::kHOLD_DELAY = 300;
 const uint8_t MapDialog::kHOLD_OFFSET = 10;
 const std::string MapDialog::kITEM_COLOR = "ffc400";
+const uint16_t MapDialog::kLAYOUT_CACHE_MAX = 64;
 const uint8_t MapDialog::kLINE_SPACING = 12;
 const uint8_t MapDialog::kMARGIN_SIDES = 50;
 const uint8_t MapDialog::kMARGIN_TOP = 35;
@@ -196,6 +197,8 @@ void MapDialog::clearData()
   event_handler = nullptr;
   font_normal = nullptr;
   font_title = nullptr;
+  layout_cache.clear();
+  layout_prefetch = 0;
   notification_queue.clear();
   notification_time = 0;
   notification_waiting.clear();
@@ -207,6 +210,7 @@ void MapDialog::clearData()
   source = nullptr;
   system_options = nullptr;
   target = nullptr;
+  text_clip.clear();
   text_index = 0.0;
   text_index_max = 0;
   text_lines.clear();
@@ -216,6 +220,7 @@ void MapDialog::clearData()
   text_strings.clear();
   text_top = 0;
   text_update = false;
+  text_widths.clear();
   thing_active = nullptr;
   thing_data.clear();
 
@@ -291,6 +296,9 @@ void MapDialog::deleteFonts()
 
   TTF_CloseFont(font_title);
   font_title = nullptr;
+
+  /* Layouts were measured with the old fonts */
+  layout_cache.clear();
 }
 
 /*
@@ -312,7 +320,31 @@ void MapDialog::executeEvent()
     pair.inst = &(conversation_inst->action_event);
     event_handler->executeEventRef(pair.base, pair.inst, target, source);
     pair.inst->has_exec = true;
+    if(source != nullptr)
+      source->setDirty();
+  }
+}
+
+/*
+ * Description: Returns the width available to the text lines of a conversation
+ *              step spoken by the given thing. A wide dialog image of the thing
+ *              eats into the right hand side of the text.
+ *
+ * Inputs: MapThing* thing - the speaking thing. Can be null
+ * Output: int - the line width, in pixels
+ */
+int MapDialog::getConversationWidth(MapThing* thing)
+{
+  int txt_length = img_convo.getWidth() - (kMARGIN_SIDES << 1);
+
+  if(thing != nullptr && thing->getDialogImage() != nullptr)
+  {
+    int width_modifier = (thing->getDialogImage()->getWidth() >> 1);
+    if(width_modifier > kMARGIN_SIDES)
+      txt_length -= (width_modifier - kMARGIN_SIDES);
   }
+
+  return txt_length;
 }
 
 /*
@@ -412,6 +444,90 @@ MapThing* MapDialog::getThingReference(int id, vector<MapThing*>* things)
   return thing_reference;
 }
 
+/*
+ * Description: Returns the layout of the text and options of a conversation
+ *              step. The text is wrapped and each line measured for the
+ *              reveal once, and then kept for the next time the same text is
+ *              shown at the same width.
+ *
+ * Inputs: Conversation* convo - the conversation step to lay out
+ *         int line_width - the width of the text lines, in pixels
+ * Output: DialogLayout* - the layout. Null if the font is unset
+ */
+DialogLayout* MapDialog::getLayout(Conversation* convo, int line_width)
+{
+  if(convo == nullptr || font_normal == nullptr)
+    return nullptr;
+
+  /* Key on the processed text, since thing names are substituted in */
+  bool multiple = (convo->next.size() > 1);
+  string text = replaceIDReferences(convo->text);
+  string key = std::to_string(line_width) + "\n" + text;
+  if(multiple)
+    for(auto& next : convo->next)
+      key += "\n" + next.text;
+
+  auto found = layout_cache.find(key);
+  if(found != layout_cache.end())
+    return &found->second;
+
+  /* Lay out a new entry, dropping the old ones if the cache is full */
+  if(layout_cache.size() >= kLAYOUT_CACHE_MAX)
+    layout_cache.clear();
+  DialogLayout& layout = layout_cache[key];
+
+  layout.lines =
+      Text::splitLineProperty(font_normal, text, line_width, multiple);
+  for(auto& line : layout.lines)
+    layout.widths.push_back(Text::revealWidths(font_normal, line));
+
+  if(multiple)
+  {
+    int options_length = line_width - kOPTION_OFFSET;
+    for(auto& next : convo->next)
+    {
+      auto option_lines =
+          Text::splitLineProperty(font_normal, next.text, options_length, true);
+      if(!option_lines.empty())
+        layout.options.push_back(option_lines.front());
+    }
+  }
+
+  return &layout;
+}
+
+/*
+ * Description: Lays out one of the conversation steps that can follow the
+ *              current one, so that shifting to it only has to render. Called
+ *              once per update while the current step is fully displayed.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void MapDialog::prefetchLayout()
+{
+  if(conversation_info == nullptr)
+    return;
+
+  /* With options, each option is skipped over to the step that follows it */
+  Conversation* next = nullptr;
+  if(conversation_info->next.size() > 1)
+  {
+    if(layout_prefetch < conversation_info->next.size() &&
+       conversation_info->next[layout_prefetch].next.size() > 0)
+      next = &conversation_info->next[layout_prefetch].next[0];
+  }
+  else if(layout_prefetch == 0 && conversation_info->next.size() > 0)
+  {
+    next = &conversation_info->next[0];
+  }
+
+  if(next != nullptr)
+    getLayout(next, getConversationWidth(getThingReference(next->thing_id)));
+  if(layout_prefetch < conversation_info->next.size())
+    layout_prefetch++;
+}
+
 /*
  * Description: Takes a list of options and creates the internal class stack
  *              of options in the Text container, rendered.
@@ -563,10 +679,10 @@ void MapDialog::setupConversation(SDL_Renderer* renderer)
     Frame* dialog_frame = nullptr;
     int render_height = img_convo.getHeight();
     int render_width = img_convo.getWidth();
-    int txt_length = img_convo.getWidth() - (kMARGIN_SIDES << 1);
 
     /* Set the active thing data plus grab image frame */
     thing_active = getThingReference(conversation_info->thing_id);
+    int txt_length = getConversationWidth(thing_active);
     if(thing_active != nullptr)
     {
       dialog_frame = thing_active->getDialogImage();
@@ -575,11 +691,6 @@ void MapDialog::setupConversation(SDL_Renderer* renderer)
       if(dialog_frame->getHeight() > render_height)
         render_height = dialog_frame->getHeight();
       render_width += dialog_frame->getWidth() / 2;
-
-      /* Modify text length limiters */
-      int width_modifier = (dialog_frame->getWidth() >> 1);
-      if(width_modifier > kMARGIN_SIDES)
-        txt_length -= (width_modifier - kMARGIN_SIDES);
     }
 
     /* Create the name information */
@@ -601,6 +712,7 @@ void MapDialog::setupConversation(SDL_Renderer* renderer)
                                              SDL_TEXTUREACCESS_TARGET,
                                              render_width, render_height);
     SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    SDL_Texture* orig_target = SDL_GetRenderTarget(renderer);
     SDL_SetRenderTarget(renderer, texture);
     SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
     SDL_RenderClear(renderer);
@@ -644,44 +756,27 @@ void MapDialog::setupConversation(SDL_Renderer* renderer)
                        src_rect.x + (src_rect.w - name_text.getWidth()) / 2,
                        src_rect.y + (src_rect.h - name_text.getHeight()) / 2);
     }
-    SDL_SetRenderTarget(renderer, nullptr);
+    SDL_SetRenderTarget(renderer, orig_target);
 
     /* Create the base frame display texture */
     frame_bottom.setTexture(texture);
 
-    /* Determine the length of the viewing area and split text lines */
-    string txt_line = replaceIDReferences(conversation_info->text);
-    if(font_normal != nullptr)
+    /* Grab the split text lines and options, laid out for the width */
+    DialogLayout* layout = getLayout(conversation_info, txt_length);
+    if(layout != nullptr)
     {
+      text_strings = layout->lines;
       if(conversation_info->next.size() > 1)
-      {
-        text_strings =
-            Text::splitLineProperty(font_normal, txt_line, txt_length, true);
-
-        /* Fill the options */
-        int options_length = txt_length - kOPTION_OFFSET;
-        vector<vector<vector<pair<string, TextProperty>>>> options_text;
-
-        for(auto i = conversation_info->next.begin();
-            i != conversation_info->next.end(); i++)
-        {
-          options_text.push_back(Text::splitLineProperty(font_normal, (*i).text,
-                                                         options_length,
-                                                         true).front());
-        }
-        renderOptions(renderer, options_text);
-      }
+        renderOptions(renderer, layout->options);
       else
-      {
-        text_strings =
-            Text::splitLineProperty(font_normal, txt_line, txt_length);
         renderOptions(nullptr);
-      }
 
       setupRenderText(text_strings, true);
+      text_widths = layout->widths;
     }
 
     conversation_delay = 0;
+    layout_prefetch = 0;
 
     /* Modify the offset if it's above the new limits */
     dialog_mode = DialogMode::CONVERSATION;
@@ -727,6 +822,7 @@ void MapDialog::setupNotification(SDL_Renderer* renderer)
       SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888,
                         SDL_TEXTUREACCESS_TARGET, render_width, render_height);
   SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+  SDL_Texture* orig_target = SDL_GetRenderTarget(renderer);
   SDL_SetRenderTarget(renderer, texture);
   SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
   SDL_RenderClear(renderer);
@@ -745,7 +841,7 @@ void MapDialog::setupNotification(SDL_Renderer* renderer)
 
     delete(*i);
   }
-  SDL_SetRenderTarget(renderer, nullptr);
+  SDL_SetRenderTarget(renderer, orig_target);
 
   /* Create the base frame display texture and set the mode */
   frame_bottom.setTexture(texture);
@@ -814,6 +910,7 @@ void MapDialog::setupPickup(SDL_Renderer* renderer, bool update)
       SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888,
                         SDL_TEXTUREACCESS_TARGET, render_width, render_height);
   SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+  SDL_Texture* orig_target = SDL_GetRenderTarget(renderer);
   SDL_SetRenderTarget(renderer, texture);
   SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
   SDL_RenderClear(renderer);
@@ -868,7 +965,7 @@ void MapDialog::setupPickup(SDL_Renderer* renderer, bool update)
   pickup_txt.render(renderer, x_index, y_index);
 
   /* Create the base frame display texture for the right hand notification */
-  SDL_SetRenderTarget(renderer, NULL);
+  SDL_SetRenderTarget(renderer, orig_target);
   frame_right.setTexture(texture);
 
   if(!update)
@@ -905,6 +1002,8 @@ void MapDialog::setupRenderText(
     for(auto i = text_lines.begin(); i != text_lines.end(); i++)
       delete *i;
     text_lines.clear();
+    text_clip.assign(lines.size(), 0);
+    text_widths.clear();
 
     /* Create a new stack of the applicable text handlers */
     for(uint16_t i = 0; i < lines.size(); i++)
@@ -1652,21 +1751,22 @@ bool MapDialog::render(SDL_Renderer* renderer)
       while(index < (text_top + kTEXT_LINES) && index < text_lines.size() &&
             length > 0)
       {
-        /* If length is >= string size, render whole string. Otherwise,
-         * only render the portion visible */
-        int line_length = Text::countLength(text_strings[index]);
-        if(length >= line_length)
+        /* Render the whole line the first time any of it is visible. After
+         * that, only the clip to the visible characters changes */
+        if(text_lines[index]->getTexture() == nullptr)
         {
           text_lines[index]->setText(renderer, text_strings[index]);
           text_lines[index]->setAlpha(dialog_alpha);
-          length -= line_length;
         }
+
+        int line_length = Text::countLength(text_strings[index]);
+        int visible = std::min(static_cast<int>(length), line_length);
+        if(index < text_widths.size() &&
+           visible < static_cast<int>(text_widths[index].size()))
+          text_clip[index] = text_widths[index][visible];
         else
-        {
-          text_lines[index]->setText(renderer, text_strings[index], length);
-          text_lines[index]->setAlpha(dialog_alpha);
-          length = 0;
-        }
+          text_clip[index] = -1;
+        length -= visible;
         index++;
       }
       text_update = false;
@@ -1700,7 +1800,9 @@ bool MapDialog::render(SDL_Renderer* renderer)
         /* Proceed to render the text, if it's in the valid range */
         if(i < text_lines.size())
         {
-          text_lines[i]->render(renderer, x_index, y_index - text_offset);
+          if(text_clip[i] != 0)
+            text_lines[i]->render(renderer, x_index, y_index - text_offset,
+                                  text_clip[i], -1);
           y_index += text_lines[i]->getHeight() + kLINE_SPACING;
         }
       }
@@ -2103,6 +2205,11 @@ void MapDialog::update(int cycle_time)
             text_index = text_index_max;
           text_update = true;
         }
+        /* Otherwise, lay out what follows while this is being read */
+        else
+        {
+          prefetchLayout();
+        }
 
         /* If there is a conversation delay, add it up during operation */
         if(conversation_delay < conversation_info->delay)
@@ -228,10 +228,26 @@ void MapInteractiveObject::handlerInteract()
     if(shift())
     {
       EventSet::unlockUsed(lock_struct);
+      dirty = true;
     }
   }
 }
 
+/*
+ * Description: Returns if the inactive time is counting down to return to the
+ *              previous state. This is when the time is used and the current
+ *              node is a state past the head.
+ *
+ * Inputs: none
+ * Output: bool - true if the inactive time is counting
+ */
+bool MapInteractiveObject::isReturnPending()
+{
+  return (getInactiveTime() != kRETURN_TIME_UNUSED &&
+          node_current != node_head && node_current != nullptr &&
+          node_current->state != nullptr);
+}
+
 /*
  * Description: Handles the connection to the parent class (thing matrix) and
  *              connecting it to the correct state, based on the current ptr.
@@ -276,6 +292,9 @@ void MapInteractiveObject::setParentFrames()
         }
       }
     }
+
+    /* The new frames may animate or start a return count */
+    wake();
   }
 }
 
@@ -357,6 +376,7 @@ bool MapInteractiveObject::shiftNext()
     /* Shift the pointer and update the frames */
     node_current = node_current->next;
     time_elapsed = 0;
+    dirty = true;
     setParentFrames();
 
     /* Fire enter event */
@@ -387,6 +407,7 @@ bool MapInteractiveObject::shiftPrevious()
 
     node_current = node_current->previous;
     time_elapsed = 0;
+    dirty = true;
     setParentFrames();
 
     /* Fire enter event */
@@ -1035,6 +1056,40 @@ Locked MapInteractiveObject::getLock()
   return lock_struct;
 }
 
+/*
+ * Description: Returns how long the IO can go without an update call. On the
+ *              active map, animated frames and transitions need every tick.
+ *              A still state with an inactive time sleeps until the return
+ *              is due and any other still state sleeps until touched.
+ *
+ * Inputs: bool active_map - true if the IOs section is the active map
+ * Output: int - the ms to sleep, kSLEEP_UNTIMED to sleep until touched or
+ *               kSLEEP_NONE if it needs an update every tick
+ */
+int MapInteractiveObject::getSleepTime(bool active_map)
+{
+  if(active_map && isActive() && isTilesSet())
+  {
+    if(isAnimated() ||
+       (node_current != nullptr && node_current->transition != nullptr))
+      return kSLEEP_NONE;
+
+    /* The return fires once the elapsed time passes the inactive time */
+    if(isReturnPending())
+    {
+      if(time_elapsed > getInactiveTime())
+        return kSLEEP_NONE;
+      return getInactiveTime() - time_elapsed + 1;
+    }
+
+    return kSLEEP_UNTIMED;
+  }
+
+  if(base == nullptr)
+    return kSLEEP_NONE;
+  return MapThing::getSleepTime(active_map);
+}
+
 /*
  * Description: Returns the current state node.
  *
@@ -1142,6 +1197,29 @@ bool MapInteractiveObject::interact(MapPerson* initiator)
   return status;
 }
 
+/*
+ * Description: Returns if the saved state has changed since it was last
+ *              saved. Includes the events of all the states.
+ *
+ * Inputs: none
+ * Output: bool - true if the IO needs to be saved again
+ */
+bool MapInteractiveObject::isDirty()
+{
+  if(MapThing::isDirty())
+    return true;
+
+  StateNode* node_parse = node_head;
+  while(node_parse != nullptr)
+  {
+    if(node_parse->state != nullptr && node_parse->state->isDirty())
+      return true;
+    node_parse = node_parse->next;
+  }
+
+  return false;
+}
+
 /*
  * Description: Returns if the inactive time is valid in either the instance
  *              or base.
@@ -1178,6 +1256,7 @@ void MapInteractiveObject::reset()
 {
   node_current = node_head;
   shifting_forward = true;
+  dirty = true;
   setParentFrames();
 }
 
@@ -1316,6 +1395,29 @@ void MapInteractiveObject::setColorMode(ColorMode mode)
   }
 }
 
+/*
+ * Description: Sets the save dirty flag of the IO. Clearing the flag also
+ *              clears the events of all the states.
+ *
+ * Inputs: bool dirty - true to mark the IO as changed. Default true
+ * Output: none
+ */
+void MapInteractiveObject::setDirty(bool dirty)
+{
+  MapThing::setDirty(dirty);
+
+  if(!dirty)
+  {
+    StateNode* node_parse = node_head;
+    while(node_parse != nullptr)
+    {
+      if(node_parse->state != nullptr)
+        node_parse->state->setDirty(false);
+      node_parse = node_parse->next;
+    }
+  }
+}
+
 /*
  * Description: Sets the inactive time before the node sequence begins reverting
  *              to prior states.
@@ -1336,10 +1438,14 @@ void MapInteractiveObject::setInactiveTime(int time)
 
   /* Reset the elapsed time */
   time_elapsed = 0;
+  wake();
 
   /* Check if it was changed */
   if(old_time != time_return)
+  {
     changed = true;
+    dirty = true;
+  }
 }
 
 /*
@@ -1354,6 +1460,7 @@ void MapInteractiveObject::setInactiveTime(int time)
 bool MapInteractiveObject::setLock(Locked new_locked)
 {
   lock_struct = new_locked;
+  dirty = true;
   return true;
 }
 
@@ -1495,6 +1602,7 @@ bool MapInteractiveObject::unlockTrigger(UnlockIOMode mode, int state_num,
     {
       EventSet::unlockTrigger(lock_struct);
       unlocked |= !lock_struct.is_locked;
+      dirty = true;
     }
   }
 
@@ -1617,10 +1725,10 @@ Floatinate MapInteractiveObject::update(int cycle_time,
       }
 
       /* Determine if the cycle time has passed on activity response */
-      if(getInactiveTime() != kRETURN_TIME_UNUSED && node_current != node_head
-                                            && node_current->state != nullptr)
+      if(isReturnPending())
       {
         time_elapsed += cycle_time;
+        dirty = true;
         if(time_elapsed > getInactiveTime())
         {
           shifting_forward = false;
@@ -1695,3 +1803,23 @@ void MapInteractiveObject::unsetFrames(bool delete_frames)
   node_head = nullptr;
   nodes_delete = true;
 }
+
+/*
+ * Description: Wakes the IO so the map resumes calling update. The time slept
+ *              on the active map is credited to a pending return, the only
+ *              count a still IO has, before the parent handles the respawn
+ *              count.
+ *
+ * Inputs: int lapsed - the ms that lapsed while sleeping. Default 0
+ * Output: none
+ */
+void MapInteractiveObject::wake(int lapsed)
+{
+  if(sleeping && sleep_active && lapsed > 0 && isReturnPending())
+  {
+    time_elapsed += lapsed;
+    dirty = true;
+  }
+
+  MapThing::wake(lapsed);
+}
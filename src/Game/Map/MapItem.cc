@@ -461,6 +461,8 @@ bool MapItem::setBase(MapThing* base)
  */
 void MapItem::setCount(uint32_t count, bool set_tiles)
 {
+  if(this->count != count)
+    dirty = true;
   this->count = count;
   if(count > 0)
     setActive(true, set_tiles);
@@ -482,6 +482,37 @@ void MapNPC::trackAvoidPlayer(int cycle_time, bool stopped)
   }
 }
 
+/*
+ * Description: Returns the approximate tile distance between the NPC and the
+ *              reference player. Used against the tracking trigger and run
+ *              distances. The player reference must be set.
+ *
+ * Inputs: none
+ * Output: int - the approximate number of tiles to the player
+ */
+int MapNPC::trackDelta()
+{
+  uint16_t tile_x = getTileX();
+  uint16_t tile_y = getTileY();
+
+  /* Delta X/Y distances */
+  int delta_x = 0;
+  if(player->getTileX() >= tile_x)
+    delta_x = player->getTileX() - tile_x;
+  else
+    delta_x = tile_x - player->getTileX();
+  int delta_y = 0;
+  if(player->getTileY() >= tile_y)
+    delta_y = player->getTileY() - tile_y;
+  else
+    delta_y = tile_y - player->getTileY();
+
+  /* Main delta */
+  if(delta_x >= delta_y)
+    return delta_x + delta_y * kPYTH_APPROX;
+  return delta_y + delta_x * kPYTH_APPROX;
+}
+
 /*
  * Description: This is called by the update call to check if the given map
  *              person reference is out of the calculated 'home' bounding
@@ -1229,6 +1260,37 @@ Direction MapNPC::getPredictedMoveRequest()
   return getMoveRequest();
 }
 
+/*
+ * Description: Returns how long the NPC can go without an update call. On top
+ *              of the person checks, tracking, the forced interaction holds,
+ *              the spotted fade and a player within the trigger distance all
+ *              count per tick. Stopped on a path node, it sleeps until the
+ *              node delay ends.
+ *
+ * Inputs: bool active_map - true if the npcs section is the active map
+ * Output: int - the ms to sleep, kSLEEP_UNTIMED to sleep until touched or
+ *               kSLEEP_NONE if it needs an update every tick
+ */
+int MapNPC::getSleepTime(bool active_map)
+{
+  int sleep_time = MapPerson::getSleepTime(active_map);
+
+  if(sleep_time == kSLEEP_UNTIMED && active_map && isActive() && isTilesSet())
+  {
+    if(starting || tracking || track_recent || forced_recent ||
+       spotted_time > 0 || isPlayerInTrackRange() ||
+       getPredictedMoveRequest() != Direction::DIRECTIONLESS)
+      return kSLEEP_NONE;
+
+    /* Waiting out the delay on the current node */
+    if(getStartingSection() == getMapSection() && node_current != nullptr &&
+       node_current->delay > npc_delay)
+      return node_current->delay - npc_delay;
+  }
+
+  return sleep_time;
+}
+
 /*
  * Description: Returns the spotted reference image frame.
  *
@@ -1370,11 +1432,31 @@ bool MapNPC::interactForced(MapPerson* initiator)
   {
     forced_recent = true;
     forced_time = 0;
+    wake();
     return true;
   }
   return false;
 }
 
+/*
+ * Description: Returns if the saved state has changed since it was last
+ *              saved. An active NPC on a looped, back and forth or random
+ *              range path advances its node position every update, so it is
+ *              always treated as changed.
+ *
+ * Inputs: none
+ * Output: bool - true if the NPC needs to be saved again
+ */
+bool MapNPC::isDirty()
+{
+  if(MapPerson::isDirty())
+    return true;
+
+  return (active && node_head != nullptr &&
+          (node_state == LOOPED || node_state == BACKANDFORTH ||
+           node_state == RANDOMRANGE));
+}
+
 /*
  * Description: Returns if the NPC will force interaction upon the player if it
  *              moves within the vicinity of the NPC.
@@ -1403,6 +1485,23 @@ bool MapNPC::isForcedInteraction(bool false_if_active)
   return forced_interaction;
 }
 
+/*
+ * Description: Returns if the reference player is in the same section and
+ *              within the distance to trigger tracking. Always false if the
+ *              NPC does not track.
+ *
+ * Inputs: none
+ * Output: bool - true if the player is within the tracking trigger distance
+ */
+bool MapNPC::isPlayerInTrackRange()
+{
+  return (track_state != TrackingState::NOTRACK && player != nullptr &&
+          !player->isInteractionDisabled() && isTilesSet() &&
+          player->isTilesSet() &&
+          getMapSection() == player->getMapSection() &&
+          trackDelta() <= track_dist);
+}
+
 /*
  * Description: Returns if there is any tracking within the NPC.
  *
@@ -1607,7 +1706,10 @@ void MapNPC::setForcedInteraction(bool forced)
 
   /* Check if it was changed */
   if(forced_interaction != old_forced)
+  {
     changed = true;
+    dirty = true;
+  }
 }
 
 /*
@@ -1675,6 +1777,7 @@ void MapNPC::setNodeState(NodeState state)
   /* Set starting moving direction */
   if(state == BACKANDFORTH)
     moving_forward = true;
+  wake();
 
   /* Fix the current node state */
 //  if(node_state == NodeState::LOOPED ||
@@ -1699,6 +1802,7 @@ void MapNPC::setNodeState(NodeState state)
 void MapNPC::setPlayer(MapPerson* player)
 {
   this->player = player;
+  wake();
 }
 
 /*
@@ -1731,6 +1835,7 @@ void MapNPC::setTrackingDist(int trigger, int max, int run)
     track_dist_max = max;
   if(run > 0)
     track_dist_run = run;
+  wake();
 }
 
 /*
@@ -1747,6 +1852,7 @@ void MapNPC::setTrackingState(TrackingState state)
   /* Modify the state */
   track_state = state;
   track_recent = false;
+  wake();
 
   /* If it was tracking, cancel it */
   if(tracking)
@@ -1760,7 +1866,10 @@ void MapNPC::setTrackingState(TrackingState state)
 
   /* Check if it was changed */
   if(track_state != old_state)
+  {
     changed = true;
+    dirty = true;
+  }
 }
 
 /*
@@ -1870,23 +1979,8 @@ Floatinate MapNPC::update(int cycle_time,
            !player->isInteractionDisabled() &&
            getMapSection() == player->getMapSection())
         {
-          /* Delta X/Y distances */
-          int delta_x = 0;
-          if(player->getTileX() >= tile_x)
-            delta_x = player->getTileX() - tile_x;
-          else
-            delta_x = tile_x - player->getTileX();
-          int delta_y = 0;
-          if(player->getTileY() >= tile_y)
-            delta_y = player->getTileY() - tile_y;
-          else
-            delta_y = tile_y - player->getTileY();
-
           /* Main delta */
-          if(delta_x >= delta_y)
-            delta = delta_x + delta_y * kPYTH_APPROX;
-          else
-            delta = delta_y + delta_x * kPYTH_APPROX;
+          delta = trackDelta();
 
           /* Logic for when NPC is not currently tracking */
           if(!tracking)
@@ -2073,6 +2167,28 @@ Floatinate MapNPC::update(int cycle_time,
   return MapPerson::update(cycle_time, tile_set, active_map);
 }
 
+/*
+ * Description: Wakes the NPC so the map resumes calling update. The time
+ *              slept on the active map is credited to a pending node delay,
+ *              the only count an idle NPC has, before the parent handles the
+ *              respawn count.
+ *
+ * Inputs: int lapsed - the ms that lapsed while sleeping. Default 0
+ * Output: none
+ */
+void MapNPC::wake(int lapsed)
+{
+  if(sleeping && sleep_active && lapsed > 0 && node_current != nullptr &&
+     node_current->delay > npc_delay)
+  {
+    npc_delay += lapsed;
+    if(npc_delay > node_current->delay)
+      npc_delay = node_current->delay;
+  }
+
+  MapPerson::wake(lapsed);
+}
+
 /*=============================================================================
  * PUBLIC STATIC FUNCTIONS
  *============================================================================*/
@@ -208,7 +208,10 @@ void MapPerson::addDirection(Direction direction)
 
   /* If it doesn't exist, push it onto the stack */
   if(!contains)
+  {
     movement_stack.push_back(direction);
+    wake();
+  }
 }
 
 /*
@@ -432,6 +435,8 @@ bool MapPerson::setDirection(Direction direction, bool set_movement,
       setMatrix(state);
 
     /* Finally set the in class direction */
+    if(this->direction != direction)
+      dirty = true;
     this->direction = direction;
   }
 
@@ -850,6 +855,25 @@ MapPerson* MapPerson::getPlayer()
   return nullptr;
 }
 
+/*
+ * Description: Returns how long the person can go without an update call. On
+ *              the active map, it needs every tick while walking, holding a
+ *              move request or paused to face a target. Standing idle, it
+ *              rests on the head frame until touched.
+ *
+ * Inputs: bool active_map - true if the persons section is the active map
+ * Output: int - the ms to sleep, kSLEEP_UNTIMED to sleep until touched or
+ *               kSLEEP_NONE if it needs an update every tick
+ */
+int MapPerson::getSleepTime(bool active_map)
+{
+  if(active_map && isActive() && isTilesSet() &&
+     (isMoving() || isMoveRequested() || getMovementPaused()))
+    return kSLEEP_NONE;
+
+  return MapThing::getSleepTime(active_map);
+}
+
 /*
  * Description: Returns the starting facing direction of the person
  *
@@ -1185,6 +1209,11 @@ void MapPerson::setColorMode(ColorMode mode)
  */
 void MapPerson::setMoveFreeze(bool freeze)
 {
+  if(move_freeze != freeze)
+  {
+    dirty = true;
+    wake();
+  }
   move_freeze = freeze;
 }
 
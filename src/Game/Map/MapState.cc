@@ -290,6 +290,19 @@ bool MapState::isDataToSave()
   return false;
 }
 
+/*
+ * Description: Checks if the saved state of any of the events has changed
+ *              since the dirty flags were last cleared.
+ *
+ * Inputs: none
+ * Output: bool - true if an event needs to be saved again
+ */
+bool MapState::isDirty()
+{
+  return (event_enter.isDirty() || event_exit.isDirty() ||
+          event_use.isDirty() || event_walkover.isDirty());
+}
+
 /*
  * Description: Returns if the enter event for the state is set.
  *
@@ -410,6 +423,20 @@ void MapState::setBase(MapState* new_base)
   }
 }
 
+/*
+ * Description: Sets or clears the save dirty flag of all events in the state.
+ *
+ * Inputs: bool dirty - true to mark the events as changed. Default true
+ * Output: none
+ */
+void MapState::setDirty(bool dirty)
+{
+  event_enter.setDirty(dirty);
+  event_exit.setDirty(dirty);
+  event_use.setDirty(dirty);
+  event_walkover.setDirty(dirty);
+}
+
 /*
  * Description: Sets the event handler to create and manage all existing events
  *              that get fired throughout interaction with the class. This is
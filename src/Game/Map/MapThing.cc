@@ -21,6 +21,8 @@ const float MapThing::kMOVE_FACTOR = 4096.0;
 const int MapThing::kPLAYER_ID = 0;
 const uint8_t MapThing::kRAW_MULTIPLIER = 10;
 const int MapThing::kUNSET_ID = -1;
+const int MapThing::kSLEEP_NONE = -1;
+const int MapThing::kSLEEP_UNTIMED = 0;
 
 /*============================================================================
  * CONSTRUCTORS / DESTRUCTORS
@@ -306,6 +308,31 @@ Tile* MapThing::getTilePrevious(uint32_t x, uint32_t y)
   return NULL;
 }
 
+/*
+ * Description: Returns if the current frames of the thing change as time
+ *              passes. This mirrors animate(): things with a base control
+ *              step through its frame count and the rest step through each
+ *              sprite in the matrix.
+ *
+ * Inputs: none
+ * Output: bool - true if an animate call can change the frames
+ */
+bool MapThing::isAnimated()
+{
+  if(base_category >= ThingBase::PERSON)
+    return (base_control != nullptr && base_control->num_frames > 1);
+
+  SpriteMatrix* sprite_set = getMatrix();
+  if(sprite_set != nullptr)
+    for(uint16_t i = 0; i < sprite_set->width(); i++)
+      for(uint16_t j = 0; j < sprite_set->height(); j++)
+        if(sprite_set->at(i, j) != nullptr &&
+           sprite_set->at(i, j)->getSize() > 1)
+          return true;
+
+  return false;
+}
+
 /*
  * Description: Checks if there is data to save for the particular thing. This
  *              is virtualized for all children
@@ -566,6 +593,8 @@ bool MapThing::setDirection(Direction new_direction)
 
   /* Update the direction */
   movement = new_direction;
+  if(changed)
+    wake();
 
   return changed;
 }
@@ -708,8 +737,9 @@ bool MapThing::setTiles(std::vector<std::vector<Tile*>> tile_set,
      tile_set.size() == sprite_set->width() &&
      tile_set.back().size() == sprite_set->height())
   {
-    /* First, unset all tiles */
+    /* First, unset all tiles and make sure the map updates the thing again */
     unsetTiles(no_events);
+    wake();
     uint32_t end_x = 0;
     uint32_t end_y = 0;
 
@@ -767,6 +797,7 @@ bool MapThing::setTiles(std::vector<std::vector<Tile*>> tile_set,
         active = true;
         tile_main = tile_set;
         tile_section = section;
+        dirty = true;
       }
     }
 
@@ -880,6 +911,7 @@ bool MapThing::tileMoveStart(std::vector<std::vector<Tile*>> tile_set,
     {
       tile_prev = tile_main;
       tile_main = tile_set;
+      dirty = true;
     }
     else
     {
@@ -1155,6 +1187,7 @@ void MapThing::clear()
     delete base_control;
   base_control = NULL;
   changed = false;
+  dirty = true;
   MapThing::clearAllMovement();
   setDescription("");
   setEventHandler(NULL);
@@ -1164,6 +1197,9 @@ void MapThing::clear()
   setMovementPaused(false);
   setName("");
   setSpeed(kDEFAULT_SPEED);
+  sleeping = false;
+  sleep_active = false;
+  sleep_clock = 0;
   target = NULL;
   visible = true;
 
@@ -1193,7 +1229,10 @@ void MapThing::clearAllMovement()
 void MapThing::clearTarget()
 {
   if(target != NULL)
+  {
     setMovementPaused(false);
+    wake();
+  }
   target = NULL;
 }
 
@@ -1710,6 +1749,52 @@ bool MapThing::getPassabilityExiting(Tile* frame_tile, Direction dir)
   return true;
 }
 
+/*
+ * Description: Returns the map clock (ms) at the point the thing was put to
+ *              sleep. Only valid while isSleeping() is true.
+ *
+ * Inputs: none
+ * Output: uint32_t - the map clock at sleep
+ */
+uint32_t MapThing::getSleepClock() const
+{
+  return sleep_clock;
+}
+
+/*
+ * Description: Returns how long the thing can go without an update call. This
+ *              mirrors the update() paths: base things animate every tick and
+ *              active placed things only need it while moving on the active
+ *              map. Otherwise they do nothing until touched and inactive
+ *              things only count down to their respawn. Virtualized for the
+ *              children with their own per tick state.
+ *
+ * Inputs: bool active_map - true if the things section is the active map
+ * Output: int - the ms to sleep, kSLEEP_UNTIMED to sleep until touched or
+ *               kSLEEP_NONE if it needs an update every tick
+ */
+int MapThing::getSleepTime(bool active_map)
+{
+  if(getBase() == nullptr)
+    return kSLEEP_NONE;
+
+  if(isActive() && isTilesSet())
+  {
+    if(active_map && isMoving())
+      return kSLEEP_NONE;
+    return kSLEEP_UNTIMED;
+  }
+
+  if(active_time >= 0)
+  {
+    if(active_lapsed >= active_time)
+      return kSLEEP_NONE;
+    return active_time - active_lapsed;
+  }
+
+  return kSLEEP_UNTIMED;
+}
+
 /*
  * Description: Returns the reference sound ID. If less than 0, it is unset.
  *
@@ -2019,6 +2104,19 @@ bool MapThing::isAlmostOnTile(int cycle_time)
   return false;
 }
 
+/*
+ * Description: Returns if the state written by saveData() has changed since
+ *              the dirty flag was last cleared. This includes the event set
+ *              of the thing.
+ *
+ * Inputs: none
+ * Output: bool - true if the thing needs to be saved again
+ */
+bool MapThing::isDirty()
+{
+  return (dirty || event_set.isDirty());
+}
+
 /*
  * Description: Returns if a move is currently in the request queue.
  *
@@ -2073,6 +2171,18 @@ bool MapThing::isOnTile()
   return false;
 }
 
+/*
+ * Description: Returns if the thing is sleeping. A sleeping thing is idle and
+ *              is skipped by the map until its wake up fires or it is touched.
+ *
+ * Inputs: none
+ * Output: bool - true if sleeping
+ */
+bool MapThing::isSleeping() const
+{
+  return sleeping;
+}
+
 /*
  * Description: Returns if the tiles have been set, that associate to where the
  *              thing is being rendered to.
@@ -2320,6 +2430,8 @@ bool MapThing::setActive(bool active, bool set_tiles)
     /* Reset the lapsed time and set changed */
     active_lapsed = 0;
     changed = true;
+    dirty = true;
+    wake();
 
     /* Update the thing placement */
     if(set_tiles)
@@ -2354,10 +2466,14 @@ void MapThing::setActiveRespawn(int time)
 
   /* Reset the elapsed active time */
   active_lapsed = 0;
+  wake();
 
   /* Check if it was changed */
   if(old_time != active_time)
+  {
     changed = true;
+    dirty = true;
+  }
 }
 
 /*
@@ -2432,6 +2548,20 @@ bool MapThing::setDialogImage(std::string path, SDL_Renderer* renderer)
   return dialog_image.setTexture(path, renderer);
 }
 
+/*
+ * Description: Sets the save dirty flag of the thing. Clearing the flag, done
+ *              once the thing has been saved, also clears the event set.
+ *
+ * Inputs: bool dirty - true to mark the thing as changed. Default true
+ * Output: none
+ */
+void MapThing::setDirty(bool dirty)
+{
+  this->dirty = dirty;
+  if(!dirty)
+    event_set.setDirty(false);
+}
+
 /*
  * Description: Sets the event handler to create and manage all existing events
  *              that get fired throughout interaction with the class. This is
@@ -2657,7 +2787,10 @@ void MapThing::setSpeed(uint16_t speed)
 
   /* Check if it was changed */
   if(old_speed != speed)
+  {
     changed = true;
+    dirty = true;
+  }
 }
 
 /*
@@ -2675,6 +2808,7 @@ bool MapThing::setTarget(MapThing* target)
   {
     setMovementPaused(true);
     this->target = target;
+    wake();
     return true;
   }
 
@@ -2754,13 +2888,32 @@ void MapThing::setVisibility(bool visible)
 {
   /* Check if the visibility is changed */
   if(this->visible != visible)
+  {
     changed = true;
+    dirty = true;
+  }
 
   /* Update the visibility */
   // TODO: Implement fade instead of instant
   this->visible = visible;
 }
 
+/*
+ * Description: Puts the thing to sleep. The map will skip updating it until
+ *              it is woken.
+ *
+ * Inputs: uint32_t clock - the map clock (ms) at the point of sleeping
+ *         bool active_map - true if it sleeps in the active section, where
+ *                           the children count down their own timers
+ * Output: none
+ */
+void MapThing::sleep(uint32_t clock, bool active_map)
+{
+  sleeping = true;
+  sleep_active = active_map;
+  sleep_clock = clock;
+}
+
 /*
  * Description: Triggers on the walk off of the passed in person pointer. This
  *              does nothing in the MapThing (virtual -> used elsewhere)
@@ -2819,6 +2972,7 @@ Floatinate MapThing::update(int cycle_time,
   else if(active_time >= 0)
   {
     active_lapsed += cycle_time;
+    dirty = true;
     if(active_lapsed >= active_time)
       setActive(true);
   }
@@ -2894,3 +3048,25 @@ void MapThing::unsetTiles(bool no_events)
   tile_prev.clear();
   tile_section = 0;
 }
+
+/*
+ * Description: Wakes the thing so the map resumes calling update. The time
+ *              lapsed while sleeping is credited to the respawn count down,
+ *              which is the only state that advances while idle.
+ *
+ * Inputs: int lapsed - the ms that lapsed while sleeping. Default 0
+ * Output: none
+ */
+void MapThing::wake(int lapsed)
+{
+  if(sleeping)
+  {
+    sleeping = false;
+
+    if(lapsed > 0 && !(isActive() && isTilesSet()) && active_time >= 0)
+    {
+      active_lapsed += lapsed;
+      dirty = true;
+    }
+  }
+}
@@ -32,6 +32,7 @@ const uint8_t Tile::kUPPER_COUNT_MAX = 5;
 Tile::Tile()
 {
   event_handler = NULL;
+  events = nullptr;
   clear();
 }
 
@@ -298,17 +299,20 @@ void Tile::clear(bool just_sprites)
 }
 
 /*
- * Description: Clears all events stored within the class. Call only works if
- *              the event handler has already been set up and is available.
- *              Note that if there is no event handler, no events fire.
+ * Description: Clears all events referenced by the class and releases the
+ *              reference. The event storage itself is owned by the map.
  *
  * Inputs: none
  * Output: bool - status if the events were cleared.
  */
 bool Tile::clearEvents()
 {
-  event_enter.clear();
-  event_exit.clear();
+  if(events != nullptr)
+  {
+    events->enter.clear();
+    events->exit.clear();
+    events = nullptr;
+  }
   return true;
 }
 
@@ -354,27 +358,31 @@ Sprite* Tile::getEnhancer() const
 }
 
 /*
- * Description: Returns the tile enter event set reference. Will never return a
- *              nullptr
+ * Description: Returns the tile enter event set reference. Returns nullptr if
+ *              the tile has no events set.
  *
  * Inputs: none
  * Output: EventSet* - the enter event set
  */
 EventSet* Tile::getEventEnter()
 {
-  return &event_enter;
+  if(events != nullptr)
+    return &events->enter;
+  return nullptr;
 }
 
 /*
- * Description: Returns the tile exit event set reference. Will never return a
- *              nullptr
+ * Description: Returns the tile exit event set reference. Returns nullptr if
+ *              the tile has no events set.
  *
  * Inputs: none
  * Output: EventSet* - the exit event set
  */
 EventSet* Tile::getEventExit()
 {
-  return &event_exit;
+  if(events != nullptr)
+    return &events->exit;
+  return nullptr;
 }
 
 /*
@@ -435,9 +443,9 @@ uint16_t Tile::getItemCount() const
  *              Do not delete item pointers; it would cause unknown results.
  *
  * Inputs: none
- * Output: std::vector<MapItem*> - stack of map item pointers
+ * Output: const std::vector<MapItem*>& - stack of map item pointers
  */
-std::vector<MapItem*> Tile::getItems() const
+const std::vector<MapItem*>& Tile::getItems() const
 {
   return items;
 }
@@ -735,12 +743,14 @@ int32_t Tile::getSoundID()
   /* Loop through lowers first */
   for(int i = lower.size() - 1; found_id < 0 && i >= 0; i--)
   {
-    if(lower[i] != nullptr && lower[i]->getSize() > 0)
+    if(lower[i] != nullptr &&
+       (lower[i]->getSize() > 0 || !lower[i]->isLoaded()))
       found_id = lower[i]->getSoundID();
   }
 
   /* If still none found, proceed to check base */
-  if(found_id < 0 && base != nullptr && base->getSize() > 0)
+  if(found_id < 0 && base != nullptr &&
+     (base->getSize() > 0 || !base->isLoaded()))
     found_id = base->getSoundID();
 
   return found_id;
@@ -1090,7 +1100,8 @@ bool Tile::personMoveFinish(uint8_t render_level, bool no_events,
       if(render_level == 0 && !no_events)
       {
         /* Execute exit event, if applicable */
-        if(event_handler != NULL && !event_exit.isEmpty())
+        if(event_handler != NULL && events != nullptr &&
+           !events->exit.isEmpty())
           event_handler->executeEventSet(getEventExit(),
                                          persons_prev[render_level]);
       }
@@ -1278,6 +1289,19 @@ void Tile::setEventHandler(EventHandler* event_handler)
   this->event_handler = event_handler;
 }
 
+/*
+ * Description: Sets the reference to the enter and exit event storage of the
+ *              tile. The storage is owned by the map and only exists for tiles
+ *              with events.
+ *
+ * Inputs: TileEvents* events - the event storage reference. Null if none
+ * Output: none
+ */
+void Tile::setEvents(TileEvents* events)
+{
+  this->events = events;
+}
+
 /*
  * Description: Sets the height of the tile.
  *
@@ -1403,7 +1427,7 @@ bool Tile::setPerson(MapPerson* person, uint8_t render_level, bool no_events)
             event_handler->executePickup(items[i], true);
 
         /* Execute the enter event, if applicable */
-        if(!event_enter.isEmpty())
+        if(events != nullptr && !events->enter.isEmpty())
           event_handler->executeEventSet(getEventEnter(), person);
       }
 
@@ -1523,12 +1547,12 @@ bool Tile::updateEventEnter(XmlData data, int file_index,
                                           uint16_t section_index)
 {
   /* Parse depending on the key value */
-  if(data.getElement(file_index) == "tileevent")
+  if(events != nullptr && data.getElement(file_index) == "tileevent")
   {
     if(data.getKeyValue(file_index) == "enter")
-      return event_enter.loadData(data, file_index + 2, section_index);
+      return events->enter.loadData(data, file_index + 2, section_index);
     else if(data.getKeyValue(file_index) == "enterset")
-      return event_enter.loadData(data, file_index + 3, section_index);
+      return events->enter.loadData(data, file_index + 3, section_index);
   }
   return false;
 }
@@ -1544,13 +1568,13 @@ bool Tile::updateEventEnter(XmlData data, int file_index,
  */
 bool Tile::updateEventExit(XmlData data, int file_index, uint16_t section_index)
 {
-    /* Parse depending on the key value */
-  if(data.getElement(file_index) == "tileevent")
+  /* Parse depending on the key value */
+  if(events != nullptr && data.getElement(file_index) == "tileevent")
   {
     if(data.getKeyValue(file_index) == "exit")
-      return event_exit.loadData(data, file_index + 2, section_index);
+      return events->exit.loadData(data, file_index + 2, section_index);
     else if(data.getKeyValue(file_index) == "exitset")
-      return event_exit.loadData(data, file_index + 3, section_index);
+      return events->exit.loadData(data, file_index + 3, section_index);
   }
   return false;
 }
@@ -1743,7 +1767,8 @@ bool Tile::unsetPerson(uint8_t render_level, bool no_events)
       if(render_level == 0 && !no_events)
       {
         /* Execute exit event, if applicable */
-        if(event_handler != nullptr && !event_exit.isEmpty())
+        if(event_handler != nullptr && events != nullptr &&
+           !events->exit.isEmpty())
           event_handler->executeEventSet(getEventExit(),
                                          persons_main[render_level]);
       }
@@ -0,0 +1,180 @@
+/******************************************************************************
+ * Class Name: TimerWheel
+ * Date Created: October 19, 2026
+ * Inheritance: none
+ * Description: A hierarchical timer wheel for scheduling the wake up of idle
+ *              map things. Each level holds a ring of slots, with each slot
+ *              on a level spanning the full ring of the level below. Entries
+ *              cascade down a level as their deadline approaches, so adding
+ *              and firing a timer is constant time regardless of how many
+ *              things are waiting.
+ *
+ * Notes
+ * -----
+ *
+ * [1]: Delays longer than the top level can hold are clamped. A thing that
+ *      wakes early just re-evaluates and schedules the remaining time again.
+ *****************************************************************************/
+#include "Game/Map/TimerWheel.h"
+
+/* Constant Implementation - see header file for descriptions */
+const uint8_t TimerWheel::kLEVELS = 4;
+const uint8_t TimerWheel::kSLOT_BITS = 6;
+const uint16_t TimerWheel::kSLOTS = 1 << kSLOT_BITS;
+const uint32_t TimerWheel::kTICK_MS = 16;
+
+/*============================================================================
+ * CONSTRUCTORS / DESTRUCTORS
+ *===========================================================================*/
+
+/*
+ * Description: Constructor function - sets up an empty wheel at clock 0
+ *
+ * Inputs: none
+ */
+TimerWheel::TimerWheel()
+{
+  slots.resize(kLEVELS * kSLOTS);
+  clear();
+}
+
+/*============================================================================
+ * PRIVATE FUNCTIONS
+ *===========================================================================*/
+
+/*
+ * Description: Empties the slot of the given level that corresponds to the
+ *              current tick and re-places each entry, which will drop it to a
+ *              lower level now that its deadline is closer.
+ *
+ * Inputs: uint8_t level - the level to cascade from
+ * Output: none
+ */
+void TimerWheel::cascade(uint8_t level)
+{
+  uint16_t index = (tick >> (level * kSLOT_BITS)) & (kSLOTS - 1);
+  std::vector<TimerEntry> entries;
+  entries.swap(slots[level * kSLOTS + index]);
+
+  for(auto& entry : entries)
+    place(entry);
+}
+
+/*
+ * Description: Places the entry in the wheel. The level is the highest group
+ *              of tick bits where the expiry differs from the current tick.
+ *
+ * Inputs: const TimerEntry& entry - the entry to place
+ * Output: none
+ */
+void TimerWheel::place(const TimerEntry& entry)
+{
+  uint64_t diff = entry.expiry ^ tick;
+  uint8_t level = 0;
+
+  while(level < (kLEVELS - 1) && (diff >> ((level + 1) * kSLOT_BITS)) > 0)
+    level++;
+
+  uint16_t index = (entry.expiry >> (level * kSLOT_BITS)) & (kSLOTS - 1);
+  slots[level * kSLOTS + index].push_back(entry);
+}
+
+/*============================================================================
+ * PUBLIC FUNCTIONS
+ *===========================================================================*/
+
+/*
+ * Description: Adds a wake up for the thing, a delay of ms from the current
+ *              clock. The entry fires on the first tick at or after the delay.
+ *
+ * Inputs: MapThing* thing - the thing to wake
+ *         uint32_t delay - the delay, in ms
+ * Output: none
+ */
+void TimerWheel::add(MapThing* thing, uint32_t delay)
+{
+  if(thing != nullptr)
+  {
+    uint64_t max_ticks = (1ull << ((kLEVELS - 1) * kSLOT_BITS)) - 1;
+    uint64_t ticks = (delay + tick_remainder + kTICK_MS - 1) / kTICK_MS;
+    if(ticks == 0)
+      ticks = 1;
+    else if(ticks > max_ticks)
+      ticks = max_ticks;
+
+    TimerEntry entry;
+    entry.thing = thing;
+    entry.sleep_clock = clock;
+    entry.expiry = tick + ticks;
+
+    place(entry);
+  }
+}
+
+/*
+ * Description: Clears all pending wake ups and resets the clock.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void TimerWheel::clear()
+{
+  for(auto& slot : slots)
+    slot.clear();
+
+  clock = 0;
+  tick = 0;
+  tick_remainder = 0;
+}
+
+/*
+ * Description: Returns the running clock of the wheel.
+ *
+ * Inputs: none
+ * Output: uint32_t - the clock, in milliseconds
+ */
+uint32_t TimerWheel::getClock() const
+{
+  return clock;
+}
+
+/*
+ * Description: Advances the clock by the cycle time and processes each whole
+ *              tick. All entries that expire are appended to the fired stack.
+ *              Fired entries may be stale (the thing was woken some other
+ *              way), which is for the caller to check.
+ *
+ * Inputs: int cycle_time - the ms since the last update
+ *         std::vector<TimerEntry>& fired - the stack to append fired entries
+ * Output: none
+ */
+void TimerWheel::update(int cycle_time, std::vector<TimerEntry>& fired)
+{
+  if(cycle_time <= 0)
+    return;
+
+  clock += cycle_time;
+  tick_remainder += cycle_time;
+
+  while(tick_remainder >= kTICK_MS)
+  {
+    tick_remainder -= kTICK_MS;
+    tick++;
+
+    /* Cascade the upper levels as the lower ones wrap around */
+    for(uint8_t level = 1; level < kLEVELS; level++)
+    {
+      if((tick & ((1ull << (level * kSLOT_BITS)) - 1)) != 0)
+        break;
+      cascade(level);
+    }
+
+    /* Fire the current slot */
+    auto& slot = slots[tick & (kSLOTS - 1)];
+    if(!slot.empty())
+    {
+      fired.insert(fired.end(), slot.begin(), slot.end());
+      slot.clear();
+    }
+  }
+}
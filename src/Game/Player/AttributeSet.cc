@@ -65,7 +65,7 @@ const int32_t AttributeSet::kDEFAULT = 0;
 const int32_t AttributeSet::kMIN_VALUE = -9999;
 const int32_t AttributeSet::kMIN_P_VALUE = 0;
 const uint32_t AttributeSet::kMAX_VALUE = 999999;
-const uint32_t AttributeSet::kNUM_ELEMENTS = 9;
+constexpr uint32_t AttributeSet::kNUM_ELEMENTS;
 
 /*=============================================================================
  * CONSTRUCTORS / DESTRUCTORS
@@ -104,7 +104,7 @@ AttributeSet::AttributeSet(const int32_t& preset_level, const bool& personal,
 /*
  * Description: Normal constructor: constructs an AttributeSet given a
  *              std::vector<int> of values to be assigned. This
- *              vector must be of size kSHORT_NAMES.size() or the values will
+ *              vector must be of size kNUM_ELEMENTS or the values will
  *              be set to default.
  *
  * Inputs: std::vector<int> new_values - vector of values to be set
@@ -112,11 +112,10 @@ AttributeSet::AttributeSet(const int32_t& preset_level, const bool& personal,
 AttributeSet::AttributeSet(const std::vector<int32_t>& new_values,
                            const bool& personal, const bool& constant)
 {
-  if(new_values.size() == kSHORT_NAMES.size())
-    values = new_values;
+  if(new_values.size() == kNUM_ELEMENTS)
+    std::copy(begin(new_values), end(new_values), begin(values));
   else
-    for(size_t i = 0; i < kSHORT_NAMES.size(); i++)
-      values.push_back(kDEFAULT);
+    values.fill(kDEFAULT);
 
   cleanUp();
   classSetup(personal, constant);
@@ -142,6 +141,21 @@ void AttributeSet::classSetup(const bool& personal, const bool& constant)
     flags |= AttributeState::CONSTANT;
 }
 
+/*
+ * Description: Returns the lowest value any stat in the set may take, which
+ *              depends on whether the set is flagged as personal.
+ *
+ * Inputs: none
+ * Output: int32_t - the minimum value of a stat in this set
+ */
+int32_t AttributeSet::getMinValue() const
+{
+  if(getFlag(AttributeState::PERSONAL))
+    return kMIN_P_VALUE;
+
+  return kMIN_VALUE;
+}
+
 /*=============================================================================
  * PUBLIC FUNCTIONS
  *============================================================================*/
@@ -156,9 +170,29 @@ void AttributeSet::classSetup(const bool& personal, const bool& constant)
 void AttributeSet::buildAsPreset(const size_t& level)
 {
   if(level == 0 || level > kPRESETS.size())
-    values = std::vector<int>(kSHORT_NAMES.size(), kDEFAULT);
+    values.fill(kDEFAULT);
   else
-    values = kPRESETS.at(level - 1);
+    std::copy(begin(kPRESETS[level - 1]), end(kPRESETS[level - 1]),
+              begin(values));
+}
+
+/*
+ * Description: Clamps every value in the set within [min_value, max_value].
+ *              Written as a plain branchless loop over the fixed array so the
+ *              compiler is able to vectorize it.
+ *
+ * Inputs: const int32_t& min_value - the lower bound of every stat
+ *         const int32_t& max_value - the upper bound of every stat
+ * Output: none
+ */
+void AttributeSet::clamp(const int32_t& min_value, const int32_t& max_value)
+{
+  for(uint32_t i = 0; i < kNUM_ELEMENTS; i++)
+  {
+    auto value = values[i];
+    value = (value < min_value) ? min_value : value;
+    values[i] = (value > max_value) ? max_value : value;
+  }
 }
 
 /*
@@ -170,21 +204,25 @@ void AttributeSet::buildAsPreset(const size_t& level)
  */
 void AttributeSet::cleanUp()
 {
-  if(values.size() != kSHORT_NAMES.size())
-  {
-    this->print(false);
-    std::cout << "[Warning] Wrong number values in AttributeSet" << std::endl;
-  }
-
-  int32_t min_value = kMIN_VALUE;
-  int32_t max_value = static_cast<int32_t>(kMAX_VALUE);
+  if(!getFlag(AttributeState::CONSTANT))
+    clamp(getMinValue(), static_cast<int32_t>(kMAX_VALUE));
+}
 
-  if(getFlag(AttributeState::PERSONAL))
-    min_value = kMIN_P_VALUE;
+/*
+ * Description: Multiplies each stat by its corresponding factor, flooring the
+ *              result. Values are not range checked; call cleanUp() after.
+ *
+ * Inputs: const FactorBlock& factors - the factor to apply to each stat
+ * Output: none
+ */
+void AttributeSet::multiply(const FactorBlock& factors)
+{
+  if(getFlag(AttributeState::CONSTANT))
+    return;
 
-  if(!getFlag(AttributeState::CONSTANT))
-    for(auto it = values.begin(); it != values.end(); ++it)
-      (*it) = Helpers::setInRange((*it), min_value, max_value);
+  for(uint32_t i = 0; i < kNUM_ELEMENTS; i++)
+    values[i] = static_cast<int32_t>(
+        std::floor(static_cast<float>(values[i]) * factors[i]));
 }
 
 /*
@@ -219,16 +257,11 @@ bool AttributeSet::alterStat(const int32_t& index, const int32_t& amount)
   if(getFlag(AttributeState::CONSTANT))
     return false;
 
-  if(index >= 0 && index < static_cast<int>(kSHORT_NAMES.size()))
+  if(index >= 0 && index < static_cast<int32_t>(kNUM_ELEMENTS))
   {
-    int32_t min_value = kMIN_VALUE;
-    int32_t max_value = static_cast<int32_t>(kMAX_VALUE);
-
-    if(getFlag(AttributeState::PERSONAL))
-      min_value = kMIN_P_VALUE;
-
     values[index] += amount;
-    values[index] = Helpers::setInRange(values[index], min_value, max_value);
+    values[index] = Helpers::setInRange(values[index], getMinValue(),
+                                        static_cast<int32_t>(kMAX_VALUE));
 
     return true;
   }
@@ -283,7 +316,7 @@ bool AttributeSet::getFlag(AttributeState test_flag) const
  */
 int32_t AttributeSet::getStat(const int32_t& index) const
 {
-  if(index != -1 && index < static_cast<int32_t>(values.size()))
+  if(index >= 0 && index < static_cast<int32_t>(kNUM_ELEMENTS))
     return values[index];
 
   return -1;
@@ -345,16 +378,10 @@ bool AttributeSet::setStat(const int32_t& index, const int32_t& value)
   if(getFlag(AttributeState::CONSTANT) || index < 0)
     can_set = false;
 
-  if(can_set && index < static_cast<int32_t>(kSHORT_NAMES.size()))
+  if(can_set && index < static_cast<int32_t>(kNUM_ELEMENTS))
   {
-    auto min_value = kMIN_VALUE;
-    auto max_value = static_cast<int32_t>(kMAX_VALUE);
-
-    if(getFlag(AttributeState::PERSONAL))
-      min_value = kMIN_P_VALUE;
-
-    values[index] = value;
-    values[index] = Helpers::setInRange(values[index], min_value, max_value);
+    values[index] = Helpers::setInRange(value, getMinValue(),
+                                        static_cast<int32_t>(kMAX_VALUE));
 
     return true;
   }
@@ -499,7 +526,8 @@ int32_t AttributeSet::getIndex(const Attribute& stat)
 
 /*
  * Description: Returns the index of an attribute given a name (short or long)
- *              form representing the attribute.
+ *              form representing the attribute. This is a linear scan of the
+ *              name tables and should only be used when loading data.
  *
  * Inputs: const std::string &name - the name of the attribute to find index of
  * Output: int - the index of the corresponding attribute (if it exists)
@@ -517,14 +545,14 @@ int32_t AttributeSet::getIndex(const std::string& name)
 
 /*
  * Description: Returns the size of an attribute set (the value of
- *              kSHORT_NAMES.size())
+ *              kNUM_ELEMENTS)
  *
  * Inputs: none
  * Output: size_t - the number of values contained in an attribute set
  */
 size_t AttributeSet::getSize()
 {
-  return kSHORT_NAMES.size();
+  return kNUM_ELEMENTS;
 }
 
 /*
@@ -685,8 +713,8 @@ AttributeSet& AttributeSet::operator+=(const AttributeSet& rhs)
 
   if(!this->getFlag(AttributeState::CONSTANT))
   {
-    for(size_t i = 0; i < kSHORT_NAMES.size(); i++)
-      this->values[i] = this->values[i] + rhs.values[i];
+    for(uint32_t i = 0; i < kNUM_ELEMENTS; i++)
+      this->values[i] += rhs.values[i];
   }
 
   /* Assert the new values are within range */
@@ -711,8 +739,8 @@ AttributeSet& AttributeSet::operator-=(const AttributeSet& rhs)
 
   if(!this->getFlag(AttributeState::CONSTANT))
   {
-    for(size_t i = 0; i < kSHORT_NAMES.size(); i++)
-      this->values[i] = this->values[i] - rhs.values[i];
+    for(uint32_t i = 0; i < kNUM_ELEMENTS; i++)
+      this->values[i] -= rhs.values[i];
   }
 
   /* Assert the new values are within range */
@@ -42,7 +42,15 @@ const uint32_t Inventory::kMAX_ITEM = 25000;
 Inventory::Inventory(const uint32_t game_id, const std::string name,
                      Frame* thumb)
     : flags{static_cast<InvState>(0)},
+      index_dirty{false},
       curr_mass{0},
+      bubby_total{0},
+      item_total{0},
+      item_stacks{0},
+      key_total{0},
+      key_stacks{0},
+      views_dirty{true},
+      save_dirty{true},
       bubby_limit{0},
       equip_limit{0},
       item_limit{0},
@@ -73,30 +81,118 @@ Inventory::~Inventory()
  *============================================================================*/
 
 /*
- * Description: Calculates the total mass of the Inventory by adding up the
- *              masses of bubbies, equipments, and items.
+ * Description: Appends a Bubby with a given count to the end of the bubbies,
+ *              keeping the index and running totals up to date.
+ *
+ * Inputs: Bubby* bubby - the bubby to append
+ *         count - the count of the bubby
+ * Output: none
+ */
+void Inventory::append(Bubby* bubby, const uint16_t& count)
+{
+  bubbies.push_back(std::make_pair(bubby, count));
+  bubby_index.emplace(bubby->getGameID(), bubbies.size() - 1);
+  tally(bubby, count);
+  views_dirty = true;
+}
+
+/*
+ * Description: Appends an Item with a given count to the end of the items,
+ *              keeping the index and running totals up to date.
+ *
+ * Inputs: Item* item - the item to append
+ *         count - the count of the item
+ * Output: none
+ */
+void Inventory::append(Item* item, const uint16_t& count)
+{
+  items.push_back(std::make_pair(item, count));
+  item_index.emplace(item->getGameID(), items.size() - 1);
+  tally(item, count, 1);
+  views_dirty = true;
+}
+
+/*
+ * Description: Rebuilds the game ID to index lookups of the bubbies and items
+ *              and recounts the running totals from scratch. Only required
+ *              after the vectors are erased from or re-ordered, since the
+ *              indexes after that point shift.
+ *
+ * Note [1]: The index maps each game ID to the first index it occurs at,
+ *           which matches the order of the previous linear searches.
  *
  * Inputs: none
  * Output: none
  */
-void Inventory::calcMass()
+void Inventory::buildIndex()
 {
-  double temp_mass{0.0};
+  bubby_index.clear();
+  item_index.clear();
+  curr_mass = 0;
+  bubby_total = 0;
+  item_total = 0;
+  item_stacks = 0;
+  key_total = 0;
+  key_stacks = 0;
 
-  for(auto bubby : bubbies)
-    if(bubby.first)
-      temp_mass += (bubby.first->getMass() * bubby.second) / 1000.0;
+  for(uint32_t i = 0; i < bubbies.size(); i++)
+  {
+    if(bubbies[i].first != nullptr)
+    {
+      bubby_index.emplace(bubbies[i].first->getGameID(), i);
+      tally(bubbies[i].first, bubbies[i].second);
+    }
+  }
 
-  // for(auto equipment : equipments)
-  //   if(equipment.first)
-  //     temp_mass += (equipment.first->getMass() * equipment.second) / 1000.0;
+  for(uint32_t i = 0; i < items.size(); i++)
+  {
+    if(items[i].first != nullptr)
+    {
+      item_index.emplace(items[i].first->getGameID(), i);
+      tally(items[i].first, items[i].second, 1);
+    }
+  }
 
-  for(auto item : items)
-    if(item.first)
-      if(!item.first->getFlag(ItemFlags::KEY_ITEM))
-        temp_mass += (item.first->getMass() * item.second) / 1000.0;
+  index_dirty = false;
+}
 
-  curr_mass = temp_mass;
+/*
+ * Description: Rebuilds the cached views of battle items, key items and the
+ *              unique bubbies and items in a single pass over the vectors.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void Inventory::buildViews()
+{
+  battle_items.clear();
+  key_items.clear();
+  unique_bubbies.clear();
+  unique_items.clear();
+
+  for(auto& bubby : bubbies)
+    if(bubby.first != nullptr)
+      unique_bubbies.push_back(bubby.first);
+
+  for(auto& item : items)
+  {
+    if(item.first != nullptr)
+    {
+      unique_items.push_back(item.first);
+
+      if(item.first->getFlag(ItemFlags::KEY_ITEM))
+        key_items.push_back(item);
+
+      if((item.first->getOccasion() == ActionOccasion::BATTLE ||
+          item.first->getOccasion() == ActionOccasion::ALWAYS) &&
+         item.first->getUseSkill() != nullptr)
+      {
+        battle_items.push_back(item);
+      }
+    }
+  }
+
+  views_dirty = false;
 }
 
 /*
@@ -123,6 +219,7 @@ bool Inventory::increaseCount(const uint32_t& game_id, const uint16_t& amount)
     if(count != 0)
     {
       bubbies[index].second += amount;
+      tally(bubbies[index].first, amount);
       increased = true;
     }
   }
@@ -154,11 +251,14 @@ bool Inventory::increaseCount(const uint32_t& game_id, const uint16_t& amount)
       if(count != 0)
       {
         items[index].second += amount;
+        tally(items[index].first, amount, 0);
         increased = true;
       }
     }
   }
 
+  views_dirty |= increased;
+
   return increased;
 }
 
@@ -183,6 +283,7 @@ bool Inventory::decreaseCount(const uint32_t& game_id, const uint16_t& amount)
     if(count > 0)
     {
       bubbies[index].second -= amount;
+      tally(bubbies[index].first, -amount);
       decreased = true;
     }
   }
@@ -214,14 +315,64 @@ bool Inventory::decreaseCount(const uint32_t& game_id, const uint16_t& amount)
       if(count > 0)
       {
         items[index].second -= amount;
+        tally(items[index].first, -amount, 0);
         decreased = true;
       }
     }
   }
 
+  views_dirty |= decreased;
+
   return decreased;
 }
 
+/*
+ * Description: Adjusts the running mass and bubby count by a count of a given
+ *              Bubby. Negative counts are removals.
+ *
+ * Inputs: Bubby* bubby - the bubby being added or removed
+ *         count - the signed count of the bubby
+ * Output: none
+ */
+void Inventory::tally(Bubby* bubby, const int32_t& count)
+{
+  if(bubby != nullptr)
+  {
+    curr_mass += static_cast<int64_t>(bubby->getMass()) * count;
+    bubby_total += count;
+    save_dirty = true;
+  }
+}
+
+/*
+ * Description: Adjusts the running mass, item counts and stack counts by a
+ *              count of a given Item. Key items are tallied separately and do
+ *              not contribute any mass.
+ *
+ * Inputs: Item* item - the item being added or removed
+ *         count - the signed count of the item
+ *         stacks - the signed change in the number of stacks
+ * Output: none
+ */
+void Inventory::tally(Item* item, const int32_t& count, const int32_t& stacks)
+{
+  if(item != nullptr)
+  {
+    if(item->getFlag(ItemFlags::KEY_ITEM))
+    {
+      key_total += count;
+      key_stacks += stacks;
+    }
+    else
+    {
+      curr_mass += static_cast<int64_t>(item->getMass()) * count;
+      item_total += count;
+      item_stacks += stacks;
+    }
+    save_dirty = true;
+  }
+}
+
 /*=============================================================================
  * PUBLIC FUNCTIONS
  *============================================================================*/
@@ -254,38 +405,33 @@ AddStatus Inventory::add(Bubby* new_bubby, const uint32_t& amount, bool bypass)
       {
         if(getBubbyCount(new_bubby->getGameID(), new_bubby->getTier()) == 0)
         {
-          bubbies.push_back(std::make_pair(new_bubby, amount));
-          calcMass();
+          append(new_bubby, amount);
 
           status = AddStatus::GOOD_KEEP;
         }
         else
         {
           increaseCount(new_bubby->getGameID(), amount);
-          calcMass();
 
           status = AddStatus::GOOD_DELETE;
         }
       }
       else if(getBubbyCount(new_bubby->getGameID(), new_bubby->getTier()) == 0)
       {
-        bubbies.push_back(std::make_pair(new_bubby, amount));
-        calcMass();
+        append(new_bubby, amount);
 
         status = AddStatus::GOOD_KEEP;
       }
       else
       {
-        bubbies.push_back(std::make_pair(new_bubby, 1));
+        append(new_bubby, 1);
 
         for(uint32_t i = 1; i < amount; i++)
         {
           auto created_bubby = new Bubby(new_bubby->getType());
-          bubbies.push_back(std::make_pair(created_bubby, amount));
+          append(created_bubby, amount);
         }
 
-        calcMass();
-
         status = AddStatus::GOOD_KEEP;
       }
     }
@@ -329,23 +475,19 @@ AddStatus Inventory::add(Item* new_item, const uint32_t& amount, bool bypass)
     if(new_item->isBaseItem()) // TODO: Replace with stackable flag
     {
       for(uint32_t i = 0; i < amount; i++)
-        items.push_back(std::make_pair(new_item, 1));
-
-      calcMass();
+        append(new_item, 1);
 
       return AddStatus::GOOD_KEEP;
     }
     else if(getItemCount(new_item->getGameID()) == 0)
     {
-      items.push_back(std::make_pair(new_item, amount));
-      calcMass();
+      append(new_item, amount);
 
       return AddStatus::GOOD_KEEP;
     }
     else
     {
       increaseCount(new_item->getGameID(), amount);
-      calcMass();
 
       return AddStatus::GOOD_DELETE;
     }
@@ -412,6 +554,11 @@ void Inventory::clear(const bool& free)
   bubbies.clear();
   //equipments.clear();
   items.clear();
+
+  /* Reset the indexes, totals and views */
+  buildIndex();
+  views_dirty = true;
+  save_dirty = true;
 }
 
 /*
@@ -533,6 +680,19 @@ uint32_t Inventory::hasRoom(Item* const i, uint32_t n)
   return n;
 }
 
+/*
+ * Description: Returns if the contents written by saveData() have changed
+ *              since the dirty flag was last cleared. Set by any count change,
+ *              sort or limit change.
+ *
+ * Inputs: none
+ * Output: bool - true if the inventory needs to be saved again
+ */
+bool Inventory::isDirty()
+{
+  return save_dirty;
+}
+
 /*
  * Description: Loads the data from file associated with the inventory.
  *
@@ -725,16 +885,18 @@ bool Inventory::removeBubbyIndex(const uint32_t& index, const uint16_t& amount)
         decreaseCount(bubbies.at(index).first->getGameID(), amount);
       else if(count == amount)
       {
+        tally(bubbies[index].first, -count);
+
         if(!getFlag(InvState::SHOP_STORAGE))
           delete bubbies[index].first;
 
         bubbies[index].first = nullptr;
         bubbies.erase(begin(bubbies) + index);
+        index_dirty = true;
+        views_dirty = true;
       }
       else
         return false;
-
-      calcMass();
     }
 
     return true;
@@ -886,6 +1048,8 @@ bool Inventory::removeItemIndex(const uint32_t& index, const uint16_t& amount)
       }
       else if(count == amount)
       {
+        tally(items[index].first, -count, -1);
+
         if(!getFlag(InvState::SHOP_STORAGE))
         {
           if(!items[index].first->isBaseItem())
@@ -894,14 +1058,14 @@ bool Inventory::removeItemIndex(const uint32_t& index, const uint16_t& amount)
 
         items[index].first = nullptr;
         items.erase(begin(items) + index);
+        index_dirty = true;
+        views_dirty = true;
       }
       else
       {
         return false;
       }
 
-      calcMass();
-
       return true;
     }
   }
@@ -954,13 +1118,16 @@ bool Inventory::removeItemUID(const uint32_t& unique_id, const uint16_t& amount)
  * Description: Saves the data of this inventory to the file handler pointer.
  *
  * Inputs: FileHandler* fh - the saving file handler
+ *         std::string wrapper - the text to wrap the xml data in. If blank,
+ *                               the wrapper is written before the call
  * Output: bool - true if successful
  */
-bool Inventory::saveData(FileHandler* fh)
+bool Inventory::saveData(FileHandler* fh, std::string wrapper)
 {
   if(fh != nullptr)
   {
-    fh->writeXmlElement("inventory");
+    if(!wrapper.empty())
+      fh->writeXmlElement(wrapper);
 
     /* Limits */
     fh->writeXmlElement("limits");
@@ -1012,7 +1179,8 @@ bool Inventory::saveData(FileHandler* fh)
       }
     }
 
-    fh->writeXmlElementEnd();
+    if(!wrapper.empty())
+      fh->writeXmlElementEnd();
     return true;
   }
   return false;
@@ -1117,6 +1285,13 @@ bool Inventory::sort(const SortType sort_type, SortObjects object,
     }
   }
 
+  if(sort_status)
+  {
+    index_dirty = true;
+    views_dirty = true;
+    save_dirty = true;
+  }
+
   return sort_status;
 }
 
@@ -1139,7 +1314,15 @@ Frame* Inventory::getBackdrop()
  */
 uint32_t Inventory::getBubbyCount(const uint32_t& game_id, const uint16_t& tier)
 {
-  for(auto it = begin(bubbies); it != end(bubbies); ++it)
+  auto index = getBubbyIndex(game_id);
+
+  if(index == -1)
+    return 0;
+  if(bubbies[index].first->getTier() == static_cast<int32_t>(tier))
+    return bubbies[index].second;
+
+  /* Tiered bubbies may share a game ID, so check the remaining ones */
+  for(auto it = begin(bubbies) + index; it != end(bubbies); ++it)
   {
     if((*it).first != nullptr)
     {
@@ -1172,14 +1355,10 @@ uint32_t Inventory::getBubbyLimit()
  */
 uint32_t Inventory::getBubbyTotalCount()
 {
-  int32_t total{0};
-
-  /* First, add up values of each T0 Bubby */
-  for(auto it = begin(bubbies); it != end(bubbies); ++it)
-    if((*it).first)
-      total += (*it).second;
+  if(index_dirty)
+    buildIndex();
 
-  return total;
+  return bubby_total;
 }
 
 // /*
@@ -1232,10 +1411,12 @@ uint32_t Inventory::getEquipmentLimit()
  */
 int32_t Inventory::getBubbyIndex(const uint32_t& game_id)
 {
-  for(uint32_t i = 0; i < bubbies.size(); i++)
-    if(bubbies[i].first != nullptr)
-      if(bubbies[i].first->getGameID() == static_cast<int32_t>(game_id))
-        return i;
+  if(index_dirty)
+    buildIndex();
+
+  auto it = bubby_index.find(game_id);
+  if(it != end(bubby_index))
+    return it->second;
 
   return -1;
 }
@@ -1264,10 +1445,12 @@ int32_t Inventory::getBubbyIndex(const uint32_t& game_id)
  */
 int32_t Inventory::getItemIndex(const uint32_t& game_id)
 {
-  for(uint32_t i = 0; i < items.size(); i++)
-    if(items[i].first != nullptr)
-      if(items[i].first->getGameID() == static_cast<int32_t>(game_id))
-        return i;
+  if(index_dirty)
+    buildIndex();
+
+  auto it = item_index.find(game_id);
+  if(it != end(item_index))
+    return it->second;
 
   return -1;
 }
@@ -1287,9 +1470,9 @@ uint32_t Inventory::getItemLimit()
  * Description: Returns the vector of bubbies
  *
  * Inputs: none
- * Output: std::vector<std::pair<Bubby*, uint16_t>> - vector of bubbies
+ * Output: const std::vector<std::pair<Bubby*, uint16_t>>& - the bubbies
  */
-std::vector<std::pair<Bubby*, uint16_t>> Inventory::getBubbies()
+const std::vector<std::pair<Bubby*, uint16_t>>& Inventory::getBubbies()
 {
   return bubbies;
 }
@@ -1309,72 +1492,55 @@ std::vector<std::pair<Bubby*, uint16_t>> Inventory::getBubbies()
  * Description: Returns the vector of item
  *
  * Inputs: none
- * Output: std::vector<std::pair<Item*, uint16_t>> - vector of items
+ * Output: const std::vector<std::pair<Item*, uint16_t>>& - the items
  */
-std::vector<std::pair<Item*, uint16_t>> Inventory::getItems()
+const std::vector<std::pair<Item*, uint16_t>>& Inventory::getItems()
 {
   return items;
 }
 
 /*
- * Description: Compiles and returns a vector an amount of battle items
+ * Description: Returns the cached vector of battle items, compiling it first
+ *              if the inventory has changed since it was last requested.
  *
  * Inputs: none
- * Output: std::vector<std::pair<Item*, uint16_t>> - vector of battle items
+ * Output: const std::vector<std::pair<Item*, uint16_t>>& - battle items
  */
-std::vector<std::pair<Item*, uint16_t>> Inventory::getBattleItems()
+const std::vector<std::pair<Item*, uint16_t>>& Inventory::getBattleItems()
 {
-  std::vector<std::pair<Item*, uint16_t>> battle_items;
-
-  for(auto battle_item : items)
-  {
-    if(battle_item.first != nullptr)
-    {
-      if((battle_item.first->getOccasion() == ActionOccasion::BATTLE ||
-          battle_item.first->getOccasion() == ActionOccasion::ALWAYS) &&
-         battle_item.first->getUseSkill() != nullptr)
-      {
-        battle_items.push_back(battle_item);
-      }
-    }
-  }
+  if(views_dirty)
+    buildViews();
 
   return battle_items;
 }
 
 /*
- * Description: Compiles and returns a vector of key items
+ * Description: Returns the cached vector of key items, compiling it first if
+ *              the inventory has changed since it was last requested.
  *
  * Inputs: none
- * Output: std::vector<std::pair<Item*, uint16_t>> - vector of key items
+ * Output: const std::vector<std::pair<Item*, uint16_t>>& - key items
  */
-std::vector<std::pair<Item*, uint16_t>> Inventory::getKeyItems()
+const std::vector<std::pair<Item*, uint16_t>>& Inventory::getKeyItems()
 {
-  std::vector<std::pair<Item*, uint16_t>> key_items;
-
-  for(auto item : items)
-    if(item.first != nullptr)
-      if(item.first->getFlag(ItemFlags::KEY_ITEM))
-        key_items.push_back(std::make_pair(item.first, item.second));
+  if(views_dirty)
+    buildViews();
 
   return key_items;
 }
 
 /*
- * Description: Returns a vector of one of each bubby
+ * Description: Returns the cached vector of one of each bubby
  *
  * Inputs: none
- * Output: std::vector<Bubby*> - a vector of each bubby
+ * Output: const std::vector<Bubby*>& - a vector of each bubby
  */
-std::vector<Bubby*> Inventory::getUniqueBubbies()
+const std::vector<Bubby*>& Inventory::getUniqueBubbies()
 {
-  std::vector<Bubby*> temps;
-
-  for(auto bubby : bubbies)
-    if(bubby.first != nullptr)
-      temps.push_back(bubby.first);
+  if(views_dirty)
+    buildViews();
 
-  return temps;
+  return unique_bubbies;
 }
 
 // /*
@@ -1395,20 +1561,17 @@ std::vector<Bubby*> Inventory::getUniqueBubbies()
 // }
 
 /*
- * Description: Returns a vector of one of each item
+ * Description: Returns the cached vector of one of each item
  *
  * Inputs: none
- * Output: std::vector<Item*> - a vector of each item
+ * Output: const std::vector<Item*>& - a vector of each item
  */
-std::vector<Item*> Inventory::getUniqueItems()
+const std::vector<Item*>& Inventory::getUniqueItems()
 {
-  std::vector<Item*> temps;
+  if(views_dirty)
+    buildViews();
 
-  for(auto item : items)
-    if(item.first)
-      temps.push_back(item.first);
-
-  return temps;
+  return unique_items;
 }
 
 /*
@@ -1419,10 +1582,10 @@ std::vector<Item*> Inventory::getUniqueItems()
  */
 uint32_t Inventory::getItemCount(const uint32_t& game_id)
 {
-  for(auto& item : items)
-    if(item.first != nullptr)
-      if(item.first->getGameID() == static_cast<int32_t>(game_id))
-        return item.second;
+  auto index = getItemIndex(game_id);
+
+  if(index != -1)
+    return items[index].second;
 
   return 0;
 }
@@ -1436,14 +1599,10 @@ uint32_t Inventory::getItemCount(const uint32_t& game_id)
  */
 uint32_t Inventory::getItemStackCount(const bool& count_keys)
 {
-  uint32_t total = 0;
-
-  for(auto item : items)
-    if(item.first != nullptr)
-      if(!item.first->getFlag(ItemFlags::KEY_ITEM) || count_keys)
-        total++;
+  if(index_dirty)
+    buildIndex();
 
-  return total;
+  return count_keys ? item_stacks + key_stacks : item_stacks;
 }
 
 /*
@@ -1454,28 +1613,25 @@ uint32_t Inventory::getItemStackCount(const bool& count_keys)
  */
 uint32_t Inventory::getItemTotalCount(const bool& count_keys)
 {
-  uint32_t total = 0;
-
-  for(auto item : items)
-    if(item.first != nullptr)
-      if(!item.first->getFlag(ItemFlags::KEY_ITEM) || count_keys)
-        total += item.second;
+  if(index_dirty)
+    buildIndex();
 
-  return total;
+  return count_keys ? item_total + key_total : item_total;
 }
 
 /*
- * Description: Returns the total mass stored in the inventory (first calls
- *              a function to calculate it)
+ * Description: Returns the total mass stored in the inventory, from the
+ *              running total kept as objects are added and removed.
  *
  * Inputs: none
  * Output: double - the total mass of the Inventory
  */
 double Inventory::getMass()
 {
-  calcMass();
+  if(index_dirty)
+    buildIndex();
 
-  return curr_mass;
+  return curr_mass / 1000.0;
 }
 
 /*
@@ -1552,6 +1708,18 @@ bool Inventory::setDescription(const std::string new_description)
   return false;
 }
 
+/*
+ * Description: Sets the save dirty flag. It is cleared by the owner once the
+ *              inventory has been saved.
+ *
+ * Inputs: const bool dirty - true to mark the inventory as changed
+ * Output: none
+ */
+void Inventory::setDirty(const bool dirty)
+{
+  save_dirty = dirty;
+}
+
 /*
  * Description: Assigns a given InvState flag a given boolean value
  *
@@ -1597,6 +1765,7 @@ void Inventory::setLimits(const uint32_t bubby_lim, const uint32_t equip_lim,
   equip_limit = Helpers::setInRange(equip_lim, kMIN_ITEM, kMAX_ITEM);
   item_limit = Helpers::setInRange(item_lim, kMIN_ITEM, kMAX_ITEM);
   mass_limit = Helpers::setInRange(mass_lim, kMIN_MASS, kMAX_MASS);
+  save_dirty = true;
 }
 
 /*=============================================================================
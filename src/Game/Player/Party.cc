@@ -118,6 +118,7 @@ void Party::copySelf(const Party& source)
 
   members = source.members;
   reserve_members = source.reserve_members;
+  dirty = true;
 
   max_size = source.max_size;
 
@@ -149,6 +150,7 @@ void Party::loadDefaults()
   max_size = kMAX_MEMBERS_SLEUTH;
   party_type = PartyType::REGULAR_FOE;
   pouch = nullptr;
+  dirty = true;
 
   setFlag(PartyState::CAN_ADD_MEMBERS, true);
   setFlag(PartyState::CAN_REMOVE_MEMBERS, true);
@@ -175,6 +177,7 @@ bool Party::addMember(Person* const new_member)
      new_member)
   {
     members.push_back(new_member);
+    dirty = true;
 
     /* Ensure member is set up properly */
     setPartyType(party_type);
@@ -198,6 +201,7 @@ bool Party::clearParty()
   {
     members.clear();
     members.push_back(members.at(0));
+    dirty = true;
 
     return true;
   }
@@ -223,6 +227,7 @@ bool Party::insertMember(const uint8_t &index, Person* const new_member)
       members.insert(members.begin() + index, new_member);
     else
       members.push_back(new_member);
+    dirty = true;
 
     /* Ensure member is set up properly */
     setPartyType(party_type);
@@ -337,6 +342,7 @@ bool Party::moveMemberToReserve(Person* test_member)
       {
         members.erase(it);
         reserve_members.push_back(test_member);
+        dirty = true;
         success = true;
       }
     }
@@ -364,6 +370,7 @@ bool Party::moveReserveMember(Person* test_member)
       {
         reserve_members.erase(it);
         members.push_back(test_member);
+        dirty = true;
         success = true;
       }
     }
@@ -428,6 +435,7 @@ bool Party::removeMember(const uint8_t& index)
   if(index < members.size() && members.size() > 1)
   {
     members.erase(begin(members) + index);
+    dirty = true;
 
     return true;
   }
@@ -451,6 +459,7 @@ bool Party::removeMember(const std::string& name)
     if((*it)->getName() == name)
     {
       members.erase(it);
+      dirty = true;
 
       return true;
     }
@@ -476,6 +485,7 @@ bool Party::replaceMember(const uint8_t &index, Person* const new_member)
   {
     /* Replace the member */
     members[index] = new_member;
+    dirty = true;
 
     /* Ensure member is set up properly */
     setPartyType(party_type);
@@ -654,6 +664,7 @@ bool Party::saveData(FileHandler* fh, std::string wrapper)
     {
       fh->writeXmlElement("person", "index", i);
       members[i]->saveData(fh);
+      members[i]->setDirty(false);
       fh->writeXmlElementEnd();
     }
 
@@ -662,6 +673,7 @@ bool Party::saveData(FileHandler* fh, std::string wrapper)
     {
       fh->writeXmlElement("reserve", "index", i);
       reserve_members[i]->saveData(fh);
+      reserve_members[i]->setDirty(false);
       fh->writeXmlElementEnd();
     }
 
@@ -669,17 +681,89 @@ bool Party::saveData(FileHandler* fh, std::string wrapper)
     if(pouch != nullptr)
     {
       pouch->saveData(fh);
+      pouch->setDirty(false);
     }
 
     /* End wrapper */
     if(!wrapper.empty())
       fh->writeXmlElementEnd();
 
+    dirty = false;
     return true;
   }
   return false;
 }
 
+/*
+ * Description: Saves the party in place under the party element of an open
+ *              write, re-writing only the members and inventory that have
+ *              changed since the last save. If the members themselves have
+ *              changed (added, removed or re-ordered), the whole party is
+ *              re-written instead.
+ *
+ * Inputs: FileHandler* fh - the saving file handler
+ *         XmlData data_party - the element sequence of the party
+ * Output: bool - true if successful
+ */
+bool Party::saveDataChanged(FileHandler* fh, XmlData data_party)
+{
+  if(fh != nullptr)
+  {
+    /* Members changed - re-write it all */
+    if(dirty)
+    {
+      if(fh->purgeElement(data_party, true) == nullptr)
+        return false;
+      return saveData(fh, "");
+    }
+
+    bool success = true;
+
+    /* Changed persons and reserve persons */
+    for(uint16_t i = 0; i < members.size() + reserve_members.size(); i++)
+    {
+      bool reserve = (i >= members.size());
+      uint16_t index = reserve ? i - members.size() : i;
+      Person* member = reserve ? reserve_members[index] : members[index];
+
+      if(member->isDirty())
+      {
+        XmlData data_person(data_party);
+        data_person.addElement(reserve ? "reserve" : "person", "index",
+                               std::to_string(index));
+        if(fh->purgeElement(data_person, true) != nullptr)
+        {
+          member->saveData(fh);
+          member->setDirty(false);
+        }
+        else
+        {
+          success = false;
+        }
+      }
+    }
+
+    /* Changed inventory */
+    if(pouch != nullptr && pouch->isDirty())
+    {
+      XmlData data_pouch(data_party);
+      data_pouch.addElement("inventory");
+      if(fh->purgeElement(data_pouch, true) != nullptr)
+      {
+        pouch->saveData(fh, "");
+        pouch->setDirty(false);
+      }
+      else
+      {
+        success = false;
+      }
+    }
+
+    return success;
+  }
+  return false;
+}
+
 /*
  * Description: Assigns a given PartyState flag a given Boolean vale.
  *
@@ -718,6 +802,7 @@ bool Party::setInventory(Inventory* const new_inventory)
     delete pouch;
 
   pouch = new_inventory;
+  dirty = true;
 
   return (pouch != nullptr);
 }
@@ -736,6 +821,7 @@ bool Party::setMainMember(const uint32_t& new_main)
 
     members[0] = members.at(new_main);
     members[new_main] = old_main;
+    dirty = true;
 
     return true;
   }
@@ -161,6 +161,7 @@ void Person::copySelf(const Person& source)
 
   level = source.level;
   total_exp = source.total_exp;
+  dirty = true;
 
   sprite_ally = source.sprite_ally;
   sprite_ally_defensive = source.sprite_ally_defensive;
@@ -172,6 +173,20 @@ void Person::copySelf(const Person& source)
   sprite_foe_offensive = source.sprite_foe_offensive;
 }
 
+/*
+ * Description: Returns the current value of the stat as written by saveData().
+ *              It is only written while below the current max.
+ *
+ * Inputs: const Attribute& stat - the stat to check
+ * Output: int32_t - the current stat value. -1 if at max (not written)
+ */
+int32_t Person::getSaveStat(const Attribute& stat)
+{
+  if(curr_stats.getStat(stat) != curr_max_stats.getStat(stat))
+    return curr_stats.getStat(stat);
+  return -1;
+}
+
 /*
  * Description: Loads the default settings for a Person
  *
@@ -249,6 +264,9 @@ void Person::loadDefaults()
 void Person::setupClass()
 {
   ai_module = nullptr;
+  dirty = true;
+  save_qtdr = -1;
+  save_vita = -1;
   base_skills = nullptr;
   curr_skills = nullptr;
   learned_skills = nullptr;
@@ -430,7 +448,10 @@ void Person::updateLevel(const bool& ignore_flags)
       setPFlag(PState::MAX_LVL);
 
     if(level != before)
+    {
       updateStats();
+      dirty = true;
+    }
   }
 }
 
@@ -517,6 +538,8 @@ bool Person::addExp(const uint32_t& amount, const bool& update,
     }
   }
 
+  dirty |= can_add;
+
   if(can_add && update)
     updateLevel(ignore_flags);
 
@@ -563,6 +586,7 @@ void Person::clearLearnedSkills()
   {
     learned_skills->clear();
     updateSkills();
+    dirty = true;
   }
 }
 
@@ -644,6 +668,21 @@ uint16_t Person::findExpThisLevel()
   return curr_exp;
 }
 
+/*
+ * Description: Returns if the state written by saveData() has changed since
+ *              the dirty flag was last cleared. Set by experience, level,
+ *              modifier and learned skill changes. The VITA and QTDR are
+ *              compared against the values at the last save instead.
+ *
+ * Inputs: none
+ * Output: bool - true if the person needs to be saved again
+ */
+bool Person::isDirty()
+{
+  return (dirty || save_vita != getSaveStat(Attribute::VITA) ||
+          save_qtdr != getSaveStat(Attribute::QTDR));
+}
+
 /*
  * Description: Determines whether the person is a power defender (whether
  *they
@@ -923,6 +962,7 @@ bool Person::loseExp(const uint32_t& amount, const bool& update,
 {
   if(amount >= total_exp)
     total_exp -= amount;
+  dirty = true;
 
   if(update)
     updateLevel(ignore_flags);
@@ -958,6 +998,8 @@ bool Person::loseExpPercent(const uint16_t& percent)
     lost_exp = true;
   }
 
+  dirty |= lost_exp;
+
   return lost_exp;
 }
 
@@ -1081,51 +1123,29 @@ void Person::updateBaseStats()
     temp_max += race_class->getTopSet();
   }
 
-  std::vector<int32_t> prim_indexes;
-  std::vector<int32_t> secd_indexes;
+  /* Build the per-stat curve factors and apply them in a single pass */
+  AttributeSet::FactorBlock factors;
+  factors.fill(1.0f);
 
   if(primary != Element::NONE)
   {
-    prim_indexes.push_back(AttributeSet::getIndex(Attribute::PRAG));
-    prim_indexes.push_back(AttributeSet::getIndex(Attribute::PRFD));
-
     auto p_mod = getCurveModifier(primary_curve, true);
 
-    for(auto index : prim_indexes)
-    {
-      if(index != -1)
-      {
-        auto a = std::floor(static_cast<float>(temp.getStat(index)) * p_mod);
-        auto b =
-            std::floor(static_cast<float>(temp_max.getStat(index)) * p_mod);
-
-        temp.setStat(index, a);
-        temp_max.setStat(index, b);
-      }
-    }
+    factors[AttributeSet::getIndex(Attribute::PRAG)] = p_mod;
+    factors[AttributeSet::getIndex(Attribute::PRFD)] = p_mod;
   }
 
   if(secondary != Element::NONE)
   {
-    secd_indexes.push_back(AttributeSet::getIndex(Attribute::SEAG));
-    secd_indexes.push_back(AttributeSet::getIndex(Attribute::SEFD));
-
     auto s_mod = getCurveModifier(secondary_curve, false);
 
-    for(auto index : secd_indexes)
-    {
-      if(index != -1)
-      {
-        auto a = std::floor(static_cast<float>(temp.getStat(index)) * s_mod);
-        auto b =
-            std::floor(static_cast<float>(temp_max.getStat(index)) * s_mod);
-
-        temp.setStat(index, a);
-        temp_max.setStat(index, b);
-      }
-    }
+    factors[AttributeSet::getIndex(Attribute::SEAG)] = s_mod;
+    factors[AttributeSet::getIndex(Attribute::SEFD)] = s_mod;
   }
 
+  temp.multiply(factors);
+  temp_max.multiply(factors);
+
   temp.cleanUp();
   temp_max.cleanUp();
 
@@ -1184,10 +1204,9 @@ void Person::updateStats()
 
     for(size_t i = 0; i < AttributeSet::getSize(); i++)
     {
-      std::vector<uint32_t> stat_values{};
-      stat_values = Helpers::buildExpTable(
-          base_stats.getStat(i), base_max_stats.getStat(i), kNUM_LEVELS);
-      curr_stats.setStat(i, stat_values.at(level - 1));
+      curr_stats.setStat(i, Helpers::buildExpValue(base_stats.getStat(i),
+                                                   base_max_stats.getStat(i),
+                                                   kNUM_LEVELS, level));
     }
 
     curr_max_stats = curr_stats;
@@ -1239,15 +1258,20 @@ int32_t Person::getGameID() const
 
 /*
  * Description: Returns the learned skill set. If create flagged, it will
- *              generate the learned skills skillset if it is null
+ *              generate the learned skills skillset if it is null. Since the
+ *              set is then added to, the person is also marked dirty.
  *
  * Inputs: const bool& create - true to create it if its null
  * Output: SkillSet* - the learned set stored within the class
  */
 SkillSet* Person::getLearnedSet(const bool& create)
 {
-  if(create && learned_skills == nullptr)
-    learned_skills = new SkillSet();
+  if(create)
+  {
+    if(learned_skills == nullptr)
+      learned_skills = new SkillSet();
+    dirty = true;
+  }
   return learned_skills;
 }
 
@@ -1807,6 +1831,23 @@ bool Person::setTemp(const AttributeSet& new_temp_set)
   return false;
 }
 
+/*
+ * Description: Sets the save dirty flag. Clearing the flag, done once the
+ *              person has been saved, also takes the VITA and QTDR as saved.
+ *
+ * Inputs: const bool& dirty - true to mark the person as changed
+ * Output: none
+ */
+void Person::setDirty(const bool& dirty)
+{
+  this->dirty = dirty;
+  if(!dirty)
+  {
+    save_qtdr = getSaveStat(Attribute::QTDR);
+    save_vita = getSaveStat(Attribute::VITA);
+  }
+}
+
 /*
  * Description: Attempts to assign a new damage modifier value.
  *
@@ -1818,6 +1859,7 @@ bool Person::setDmgMod(const float& new_dmg_mod)
   if(Helpers::isInRange(new_dmg_mod, kMIN_DMG_MODI, kMAX_DMG_MODI))
   {
     dmg_mod = new_dmg_mod;
+    dirty = true;
 
     return true;
   }
@@ -1836,6 +1878,7 @@ bool Person::setExpMod(const float& new_exp_mod)
   if(Helpers::isInRange(new_exp_mod, kMIN_EXP_MODI, kMAX_EXP_MODI))
   {
     exp_mod = new_exp_mod;
+    dirty = true;
 
     return true;
   }
@@ -397,16 +397,37 @@ void Player::resetPlayTime()
 }
 
 /*
- * Description: Saves the data of this player to the file handler pointer.
+ * Description: Saves the data of this player to the player element in the file
+ *              handler. On a full save, the element is cleared and all data is
+ *              written. Otherwise, the class data is replaced and the parties
+ *              only re-write the members and inventories that changed since
+ *              the last save.
  *
  * Inputs: FileHandler* fh - the saving file handler
+ *         XmlData data_player - the element sequence of the player
+ *         bool full - true to write all the data. Default true
  * Output: bool - true if successful
  */
-bool Player::saveData(FileHandler* fh)
+bool Player::saveData(FileHandler* fh, XmlData data_player, bool full)
 {
   if(fh)
   {
-    fh->writeXmlElement("player");
+    bool success = true;
+
+    /* Clear the element, or just the class data if only saving changes */
+    if(full)
+    {
+      success &= (fh->purgeElement(data_player, true) != nullptr);
+    }
+    else
+    {
+      for(auto& element : {"credits", "gravity", "playtime", "steps"})
+      {
+        XmlData data_element(data_player);
+        data_element.addElement(element);
+        success &= fh->removeElement(data_element, true);
+      }
+    }
 
     /* Write class data */
     fh->writeXmlData("credits", credits);
@@ -422,14 +443,29 @@ bool Player::saveData(FileHandler* fh)
     fh->writeXmlData("steps", steps);
 
     /* Write parties */
-    if(sleuth)
-      sleuth->saveData(fh, "sleuth");
-    if(bearacks)
-      bearacks->saveData(fh, "bearacks");
+    if(full)
+    {
+      if(sleuth)
+        success &= sleuth->saveData(fh, "sleuth");
+      if(bearacks)
+        success &= bearacks->saveData(fh, "bearacks");
+    }
+    else
+    {
+      XmlData data_party(data_player);
+      data_party.addElement("sleuth");
+      if(sleuth)
+        success &= sleuth->saveDataChanged(fh, data_party);
+
+      data_party.removeLastElement();
+      data_party.addElement("bearacks");
+      if(bearacks)
+        success &= bearacks->saveDataChanged(fh, data_party);
+    }
 
     fh->writeXmlElementEnd();
 
-    return true;
+    return success;
   }
 
   return false;
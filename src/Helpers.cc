@@ -1564,6 +1564,32 @@ std::vector<uint32_t> Helpers::buildExpTable(const uint32_t& min,
   return table;
 }
 
+/*
+ * Description: Computes a single value of the table built by buildExpTable()
+ *              without constructing the whole table.
+ *
+ * Inputs: const uint32_t &min - the minimum value for the table
+ *         const uint32_t &max - the maximum value for the table
+ *         const uint32_t &iter - the # of iterations for the table
+ *         const uint32_t &i - the 1-indexed iteration to compute
+ * Output: uint32_t - the value at iteration i of the table
+ */
+uint32_t Helpers::buildExpValue(const uint32_t& min, const uint32_t& max,
+                                const uint32_t& iter, const uint32_t& i)
+{
+  /* Corner case if min and max are equivalent */
+  if(min == max)
+    return min;
+
+  auto b = log((double)max / min) / (iter - 1);
+  auto a = (double)min / (exp(b) - 1.0);
+
+  auto old_exp = round(a * exp(b * (i - 1)));
+  auto new_exp = round(a * exp(b * i));
+
+  return new_exp - old_exp;
+}
+
 /*
  * Description: Takes a hex color, in the form of aabbcc or aabbccdd, and
  *              returns the integers within the SDL_Color set. The format is
@@ -0,0 +1,347 @@
+/*******************************************************************************
+ * Class Name: Logger
+ * Date Created: October 19, 2026
+ * Inheritance: none
+ * Description: The logging subsystem. Messages are filtered by level, both at
+ *              compile time (LOG_LEVEL_COMPILED) and at run time per category,
+ *              before the message is even formatted. Passed messages are put
+ *              on a lock-free ring buffer and written out by a background
+ *              thread, so the caller never waits on console I/O.
+ *
+ * Notes
+ * -----
+ *
+ * [1]: The ring is a bounded multi-producer queue. Each slot carries a
+ *      sequence that says which pass of the ring it is ready for, so a
+ *      producer claims a slot with a single compare and swap on the head and
+ *      the writer only reads slots that have been published. If the ring is
+ *      full, the message is dropped and counted rather than blocking. Errors
+ *      are never dropped - they are written directly instead.
+ * [2]: The run-time levels are plain bytes. Set them before start().
+ ******************************************************************************/
+#include "Logger.h"
+
+/* Constant Implementation - see header file for descriptions */
+const uint8_t Logger::kIDLE_MS = 5;
+const uint32_t Logger::kRING_SIZE = 1024;
+
+/* Static Implementation - see header file for descriptions */
+std::atomic<uint32_t> Logger::dropped(0);
+uint8_t Logger::levels[] = {
+    static_cast<uint8_t>(LogLevel::INFO), static_cast<uint8_t>(LogLevel::INFO),
+    static_cast<uint8_t>(LogLevel::INFO), static_cast<uint8_t>(LogLevel::INFO)};
+std::unique_ptr<LogEntry[]> Logger::ring;
+std::atomic<uint32_t> Logger::ring_head(0);
+uint32_t Logger::ring_tail = 0;
+std::atomic<bool> Logger::running(false);
+std::thread Logger::writer;
+
+/*=============================================================================
+ * PRIVATE FUNCTIONS
+ *============================================================================*/
+
+/*
+ * Description: Writes out all the published messages in the ring, in order,
+ *              with one write per output stream. Only called by the single
+ *              consumer - the writer thread, or stop() once it has joined.
+ *
+ * Inputs: none
+ * Output: bool - true if any message was written
+ */
+bool Logger::drain()
+{
+  std::string out;
+  std::string err;
+  bool found = false;
+
+  while(true)
+  {
+    LogEntry& entry = ring[ring_tail & (kRING_SIZE - 1)];
+    if(entry.sequence.load(std::memory_order_acquire) != ring_tail + 1)
+      break;
+
+    format(entry.level, entry.category, entry.text, entry.length, out, err);
+    entry.sequence.store(ring_tail + kRING_SIZE, std::memory_order_release);
+    ring_tail++;
+    found = true;
+  }
+
+  /* Report any messages lost to a full ring */
+  uint32_t lost = dropped.exchange(0);
+  if(lost > 0)
+  {
+    std::string text = "Log ring full, dropped " + std::to_string(lost) +
+                       " messages";
+    format(LogLevel::WARNING, LogCategory::GENERAL, text.c_str(),
+           text.size(), out, err);
+  }
+
+  if(!out.empty())
+  {
+    fwrite(out.data(), 1, out.size(), stdout);
+    fflush(stdout);
+  }
+  if(!err.empty())
+  {
+    fwrite(err.data(), 1, err.size(), stderr);
+    fflush(stderr);
+  }
+
+  return found;
+}
+
+/*
+ * Description: Appends the message as a line, tagged with its level and
+ *              category. Errors go to the error stream, all else to out.
+ *
+ * Inputs: LogLevel level - the message level
+ *         LogCategory category - the message category
+ *         const char* text - the message text
+ *         uint16_t length - the length of the text
+ *         std::string& out - the standard output to append to
+ *         std::string& err - the error output to append to
+ * Output: none
+ */
+void Logger::format(LogLevel level, LogCategory category, const char* text,
+                    uint16_t length, std::string& out, std::string& err)
+{
+  static const char* kLEVEL_TAGS[] = {"[DEBUG]", "[INFO]", "[WARNING]",
+                                      "[ERROR]"};
+  static const char* kCATEGORY_TAGS[] = {"", "[AI] ", "[BATTLE] ", "[MAP] "};
+
+  std::string& stream = (level == LogLevel::FAULT) ? err : out;
+  stream += kLEVEL_TAGS[static_cast<uint8_t>(level)];
+  stream += ' ';
+  stream += kCATEGORY_TAGS[static_cast<uint8_t>(category)];
+  stream.append(text, length);
+  stream += '\n';
+}
+
+/*
+ * Description: Parses a level name (debug, info, warning, error or none).
+ *
+ * Inputs: const std::string& name - the lower case level name
+ *         LogLevel& level - set to the parsed level
+ * Output: bool - true if the name is a level
+ */
+bool Logger::parseLevel(const std::string& name, LogLevel& level)
+{
+  static const char* kNAMES[] = {"debug", "info", "warning", "error", "none"};
+
+  for(uint8_t i = 0; i <= static_cast<uint8_t>(LogLevel::NONE); i++)
+  {
+    if(name == kNAMES[i])
+    {
+      level = static_cast<LogLevel>(i);
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/*
+ * Description: The writer thread loop. Drains the ring and sleeps for a short
+ *              time whenever it finds it empty, until stopped.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void Logger::run()
+{
+  while(running.load(std::memory_order_acquire))
+  {
+    if(!drain())
+      std::this_thread::sleep_for(std::chrono::milliseconds(kIDLE_MS));
+  }
+}
+
+/*=============================================================================
+ * PUBLIC FUNCTIONS
+ *============================================================================*/
+
+/*
+ * Description: Sets the run-time levels from a config string. The string is a
+ *              comma separated list of either a level, which applies to all
+ *              categories, or category=level. For example: "warning,ai=debug".
+ *              Categories are general, ai, battle and map. Unknown entries are
+ *              ignored.
+ *
+ * Inputs: const char* config - the config string. Nothing is set if NULL
+ * Output: none
+ */
+void Logger::configure(const char* config)
+{
+  if(config == nullptr)
+    return;
+
+  std::istringstream stream(config);
+  std::string item;
+  while(std::getline(stream, item, ','))
+  {
+    static const char* kNAMES[] = {"general", "ai", "battle", "map"};
+    size_t split = item.find('=');
+    LogLevel level;
+
+    if(split == std::string::npos)
+    {
+      if(parseLevel(item, level))
+        setLevel(level);
+    }
+    else if(parseLevel(item.substr(split + 1), level))
+    {
+      std::string name = item.substr(0, split);
+      for(uint8_t i = 0; i < static_cast<uint8_t>(LogCategory::COUNT); i++)
+        if(name == kNAMES[i])
+          setLevel(static_cast<LogCategory>(i), level);
+    }
+  }
+}
+
+/*
+ * Description: Returns if a message of the level and category passes the
+ *              run-time filter.
+ *
+ * Inputs: LogLevel level - the message level
+ *         LogCategory category - the message category
+ * Output: bool - true if it would be written
+ */
+bool Logger::isEnabled(LogLevel level, LogCategory category)
+{
+  return (static_cast<uint8_t>(level) >=
+          levels[static_cast<uint8_t>(category)]);
+}
+
+/*
+ * Description: Sets the run-time level of all categories.
+ *
+ * Inputs: LogLevel level - the lowest level to write
+ * Output: none
+ */
+void Logger::setLevel(LogLevel level)
+{
+  for(uint8_t i = 0; i < static_cast<uint8_t>(LogCategory::COUNT); i++)
+    levels[i] = static_cast<uint8_t>(level);
+}
+
+/*
+ * Description: Sets the run-time level of a category.
+ *
+ * Inputs: LogCategory category - the category to set
+ *         LogLevel level - the lowest level to write
+ * Output: none
+ */
+void Logger::setLevel(LogCategory category, LogLevel level)
+{
+  if(category != LogCategory::COUNT)
+    levels[static_cast<uint8_t>(category)] = static_cast<uint8_t>(level);
+}
+
+/*
+ * Description: Starts the background writer thread. Messages logged before
+ *              this (or after stop()) are written directly by the caller.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void Logger::start()
+{
+  if(!running.load())
+  {
+    if(ring == nullptr)
+    {
+      ring.reset(new LogEntry[kRING_SIZE]);
+      for(uint32_t i = 0; i < kRING_SIZE; i++)
+        ring[i].sequence.store(i, std::memory_order_relaxed);
+      ring_head.store(0);
+      ring_tail = 0;
+    }
+
+    running.store(true, std::memory_order_release);
+    writer = std::thread(run);
+  }
+}
+
+/*
+ * Description: Stops the background writer and writes out any messages left
+ *              in the ring. Called from the main thread at exit.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void Logger::stop()
+{
+  if(running.exchange(false))
+  {
+    if(writer.joinable())
+      writer.join();
+    drain();
+  }
+}
+
+/*
+ * Description: Queues the message on the ring for the writer thread. Messages
+ *              over the slot size are truncated. If the writer is not running,
+ *              or the ring is full for an error, it is written directly.
+ *
+ * Inputs: LogLevel level - the message level
+ *         LogCategory category - the message category
+ *         const std::string& message - the message text
+ * Output: none
+ */
+void Logger::write(LogLevel level, LogCategory category,
+                   const std::string& message)
+{
+  if(level == LogLevel::NONE || category == LogCategory::COUNT)
+    return;
+
+  /* Claim a slot - see note [1] */
+  bool direct = !running.load(std::memory_order_acquire);
+  uint32_t pos = ring_head.load(std::memory_order_relaxed);
+  LogEntry* entry = nullptr;
+  while(entry == nullptr && !direct)
+  {
+    LogEntry& slot = ring[pos & (kRING_SIZE - 1)];
+    int32_t diff = static_cast<int32_t>(
+        slot.sequence.load(std::memory_order_acquire) - pos);
+
+    if(diff == 0)
+    {
+      if(ring_head.compare_exchange_weak(pos, pos + 1,
+                                         std::memory_order_relaxed))
+        entry = &slot;
+    }
+    else if(diff < 0)
+    {
+      if(level != LogLevel::FAULT)
+      {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+      }
+      direct = true;
+    }
+    else
+    {
+      pos = ring_head.load(std::memory_order_relaxed);
+    }
+  }
+
+  /* No writer or no room for an error - write directly */
+  if(direct)
+  {
+    std::string out;
+    std::string err;
+    format(level, category, message.c_str(), message.size(), out, err);
+    fputs(out.c_str(), stdout);
+    fputs(err.c_str(), stderr);
+    return;
+  }
+
+  /* Fill and publish it */
+  entry->level = level;
+  entry->category = category;
+  entry->length = static_cast<uint16_t>(
+      std::min(message.size(), sizeof(entry->text)));
+  memcpy(entry->text, message.data(), entry->length);
+  entry->sequence.store(pos + 1, std::memory_order_release);
+}
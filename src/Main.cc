@@ -6,7 +6,10 @@
  *              necessary subsystems and starts up the application.
  ******************************************************************************/
 #include "Application.h"
+#include "AssetPack.h"
 #include "Helpers.h"
+#include "Logger.h"
+#include "Timeline.h"
 
 #include <unistd.h>
 
@@ -73,13 +76,33 @@ int main(int argc, char** argv)
   std::string dir_string(directory);
   SDL_free(directory);
 
+  /* Build the asset pack from the assets beside the executable and exit */
+  if(init_app == "--pack")
+  {
+    bool packed = IMG_Init(IMG_INIT_PNG) &&
+                  AssetPack::build(dir_string, "assets",
+                                   dir_string + AssetPack::kPACK_FILE);
+    IMG_Quit();
+    return packed ? 0 : 1;
+  }
+
+  /* Start the log writer, with the levels from the environment if set */
+  Logger::configure(getenv("FISE_LOG"));
+  Logger::start();
+
   /* Initialize SDL libraries */
   bool success = initSDL();
+  Timeline::mark("SDL init");
 
   if(success)
   {
+    /* Load the assets from the pack, if one has been built */
+    AssetPack::mount(dir_string, dir_string + AssetPack::kPACK_FILE);
+    Timeline::mark("Asset pack");
+
     /* Create the application and start the run loop */
     Application* game_app = new Application(dir_string, init_app, map_lvl);
+    Timeline::mark("Options");
     if(game_app->initialize())
       game_app->run(map_requested);
 
@@ -87,6 +110,8 @@ int main(int argc, char** argv)
     //game_app->uninitialize();
     delete game_app;
     game_app = nullptr;
+
+    AssetPack::unmount();
   }
 
   /* Clean up SDL libraries */
@@ -96,5 +121,7 @@ int main(int argc, char** argv)
   IMG_Quit();
   SDL_Quit();
 
+  Logger::stop();
+
   return 0;
 }
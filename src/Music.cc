@@ -107,7 +107,13 @@ bool Music::setMusicFile(std::string path)
   if(!path.empty())
   {
     unsetMusicFile();
-    raw_data = Mix_LoadMUS(path.c_str());
+
+    /* The music streams from the asset pack, if packed */
+    SDL_RWops* packed = AssetPack::openFile(path);
+    if(packed != nullptr)
+      raw_data = Mix_LoadMUS_RW(packed, 1);
+    else
+      raw_data = Mix_LoadMUS(path.c_str());
 
     /* Determine if the setting of the sound was valid */
     if(raw_data == NULL)
@@ -63,7 +63,13 @@ Options::Options(std::string base_path)
   sound_handler = nullptr;
 
   setAllToDefault();
-  font_data = new Fonts(this);
+
+  /* The fonts are created on a worker while the rest of start up runs. Any
+   * font access waits for the job first */
+  font_data = nullptr;
+  font_job = std::async(std::launch::async, [this]() {
+    return new Fonts(this);
+  });
 }
 
 Options::Options(const Options& source)
@@ -74,6 +80,7 @@ Options::Options(const Options& source)
 /* Destructor function */
 Options::~Options()
 {
+  waitFonts();
   if(font_data)
     delete font_data;
 
@@ -113,6 +120,7 @@ void Options::setAllToDefault()
   setFlag(OptionState::BATTLE_ANIMATIONS, true);
   setFlag(OptionState::GUI_ENABLED, true);
   setFlag(OptionState::MUTE, false);
+  setFlag(OptionState::MAP_STREAMING, false);
 
   /* Move the flags into default flags */
   flags_default = flags;
@@ -167,6 +175,13 @@ void Options::setScreenResolution(uint8_t index)
   }
 }
 
+/* Waits for the fonts being created at start up, if not done */
+void Options::waitFonts()
+{
+  if(font_job.valid())
+    font_data = font_job.get();
+}
+
 /*=============================================================================
  * PUBLIC FUNCTIONS
  *============================================================================*/
@@ -176,7 +191,15 @@ bool Options::confirmFontSetup()
 {
   bool success = true;
   std::string path = base_path + kFONTS[font];
-  TTF_Font* test_font = TTF_OpenFont(path.c_str(), 14);
+  TTF_Font* test_font = nullptr;
+
+  /* The font library is not used across threads at once */
+  waitFonts();
+  SDL_RWops* packed = AssetPack::openFile(path);
+  if(packed != nullptr)
+    test_font = TTF_OpenFontRW(packed, 1, 14);
+  else
+    test_font = TTF_OpenFont(path.c_str(), 14);
 
   /* If the font setup fails, output the error alert */
   if(test_font == NULL)
@@ -229,6 +252,7 @@ std::string Options::getFont(uint8_t index)
 /* Returns a constructed font by enumerated value */
 TTF_Font* Options::getFontTTF(FontName font)
 {
+  waitFonts();
   if(font_data)
     return font_data->getFont(font);
 
@@ -334,6 +358,10 @@ bool Options::loadData(XmlData data, int index)
   {
     setFlag(OptionState::FAST_BATTLE, data.getDataBool(&success));
   }
+  else if(data.getElement(index) == "map_streaming")
+  {
+    setFlag(OptionState::MAP_STREAMING, data.getDataBool(&success));
+  }
   else if(data.getElement(index) == "audio_level")
   {
     audio_level = data.getDataInteger(&success);
@@ -370,6 +398,7 @@ bool Options::saveData(FileHandler* fh)
                      getFlag(OptionState::BATTLE_ANIMATIONS));
     fh->writeXmlData("gui_enabled", getFlag(OptionState::MUTE));
     fh->writeXmlData("fast_battle", getFlag(OptionState::FAST_BATTLE));
+    fh->writeXmlData("map_streaming", getFlag(OptionState::MAP_STREAMING));
 
     /* Write option values to file */
     // fh->writeXmlData("resolution_x", resolution_x);
@@ -435,45 +435,43 @@ void Sound::setLoopForever()
   loop_count = kINFINITE_LOOP;
 }
 
+/*
+ * Description: Sets the decoded sound chunk to be played the next time the
+ *              play() function is called. The sound takes ownership of the
+ *              chunk. If the chunk is NULL, nothing is changed.
+ *
+ * Inputs: Mix_Chunk* chunk - the decoded chunk, from loadChunk()
+ * Output: bool - status if the setting of the sound chunk was successful
+ */
+bool Sound::setSoundChunk(Mix_Chunk* chunk)
+{
+  if(chunk == NULL)
+    return false;
+
+  /* Unset the old and set the new data */
+  unsetSoundFile();
+  raw_data = chunk;
+  Mix_VolumeChunk(raw_data, volume);
+
+  /* Calculate length: raw / ((hz * 2 bytes * 1 (1mono, 2stereo)) / 1000) */
+  length = raw_data->alen / ((Sound::kDEFAULT_FREQUENCY * 2 * 1) / 1000);
+
+  return true;
+}
+
 /*
  * Description: Sets the sound to be played the next time the play()
  *              function is called. This tries to open it and if it
  *              fails, it will not be set and the class will be notified
  *              as well as the terminal. If the sound file was set and this
- *              set was unsuccessful, there will be no sound file set anymore.
+ *              set was unsuccessful, the previous sound file remains set.
  *
  * Inputs: std::string path - the path to the sound to add
  * Output: bool - status if the setting of the sound file was successful
  */
 bool Sound::setSoundFile(std::string path)
 {
-  /* Attempt and load the file */
-  if(!path.empty())
-  {
-    /* First, try wav loader */
-    Mix_Chunk* sound = Mix_LoadWAV(path.c_str());
-
-    /* Determine if the setting of the sound was valid */
-    if(sound == NULL)
-    {
-      std::cerr << "[WARNING] Unable to load WAV file: " << path << std::endl;
-      //<< Mix_GetError() << std::endl;
-      return false;
-    }
-
-    /* Unset the old and set the new data */
-    unsetSoundFile();
-    raw_data = sound;
-    Mix_VolumeChunk(raw_data, volume);
-
-    /* Calculate length: raw / ((hz * 2 bytes * 1 (1mono, 2stereo)) / 1000) */
-    length = raw_data->alen / ((Sound::kDEFAULT_FREQUENCY * 2 * 1) / 1000);
-
-    return true;
-  }
-
-  std::cerr << "[WARNING] Unable to load empty WAV file path." << std::endl;
-  return false;
+  return setSoundChunk(loadChunk(path));
 }
 
 // TODO: Remove - what is this and why is it needed? Volume should be controlled
@@ -609,6 +607,36 @@ int Sound::getChannelInt(SoundChannels channel)
   return static_cast<int>(channel);
 }
 
+/*
+ * Description: Decodes the sound file at the path, from the asset pack if
+ *              packed. Touches no sound state, so it is safe to call on a
+ *              worker thread. Failures are reported to the terminal.
+ *
+ * Inputs: std::string path - the path to the sound to decode
+ * Output: Mix_Chunk* - the decoded chunk (deleted by caller). NULL if fails
+ */
+Mix_Chunk* Sound::loadChunk(std::string path)
+{
+  if(path.empty())
+  {
+    std::cerr << "[WARNING] Unable to load empty WAV file path." << std::endl;
+    return NULL;
+  }
+
+  /* First, try wav loader - from the asset pack, if packed */
+  Mix_Chunk* sound = NULL;
+  SDL_RWops* packed = AssetPack::openFile(path);
+  if(packed != nullptr)
+    sound = Mix_LoadWAV_RW(packed, 1);
+  else
+    sound = Mix_LoadWAV(path.c_str());
+
+  if(sound == NULL)
+    std::cerr << "[WARNING] Unable to load WAV file: " << path << std::endl;
+
+  return sound;
+}
+
 /*
  * Description: Returns if the given channel integer is playing.
  *
@@ -8,6 +8,9 @@
  ******************************************************************************/
 #include "SoundHandler.h"
 
+/* Constant Implementation - see header file for descriptions */
+const uint8_t SoundHandler::kLOAD_THREADS = 4;
+
 /*=============================================================================
  * CONSTRUCTORS / DESTRUCTORS
  *============================================================================*/
@@ -123,6 +126,23 @@ void SoundHandler::queueCleanUp()
   }
 }
 
+/*
+ * Description: Removes any file decodes queued by load for the sound chunk,
+ *              before the chunk is deleted.
+ *
+ * Inputs: Sound* chunk - the sound chunk being removed
+ * Output: none
+ */
+void SoundHandler::unqueueLoad(Sound* chunk)
+{
+  load_queue.erase(
+      std::remove_if(load_queue.begin(), load_queue.end(),
+                     [chunk](const std::pair<Sound*, std::string>& entry) {
+                       return entry.first == chunk;
+                     }),
+      load_queue.end());
+}
+
 /*=============================================================================
  * PUBLIC FUNCTIONS
  *============================================================================*/
@@ -289,6 +309,8 @@ bool SoundHandler::isSoundSet(uint32_t id)
 
 /*
  * Description: Loads the data from file associated with the sound database.
+ *              Sound file paths are queued and only decoded once
+ *              loadFinish() is called.
  *
  * Inputs: XmlData data - the xml data structure
  *         int index - the element reference index
@@ -321,7 +343,8 @@ bool SoundHandler::load(XmlData data, int index, std::string base_path)
     }
     else if(data.getElement(index + 1) == "path")
     {
-      success &= edit_chunk->setSoundFile(base_path + data.getDataString());
+      load_queue.push_back(
+          std::make_pair(edit_chunk, base_path + data.getDataString()));
     }
     else if(data.getElement(index + 1) == "vol")
     {
@@ -340,6 +363,46 @@ bool SoundHandler::load(XmlData data, int index, std::string base_path)
   return success;
 }
 
+/*
+ * Description: Finishes the load by decoding all the sound files queued by
+ *              load(). The files are decoded across worker threads and then
+ *              set on the sound chunks on the calling thread, in the order
+ *              they were read.
+ *
+ * Inputs: none
+ * Output: bool - true if all the queued files were decoded and set
+ */
+bool SoundHandler::loadFinish()
+{
+  bool success = true;
+  std::vector<Mix_Chunk*> chunks(load_queue.size(), nullptr);
+  std::atomic<uint32_t> next{0};
+
+  /* Each worker decodes the next file in the queue, until all are done */
+  uint32_t workers = std::min(std::thread::hardware_concurrency(),
+                              static_cast<uint32_t>(kLOAD_THREADS));
+  workers = std::min(std::max(workers, 1u),
+                     static_cast<uint32_t>(load_queue.size()));
+
+  std::vector<std::future<void>> jobs;
+  for(uint32_t i = 0; i < workers; i++)
+  {
+    jobs.push_back(std::async(std::launch::async, [this, &chunks, &next]() {
+      for(uint32_t j = next++; j < load_queue.size(); j = next++)
+        chunks[j] = Sound::loadChunk(load_queue[j].second);
+    }));
+  }
+  for(auto& job : jobs)
+    job.wait();
+
+  /* Set the decoded chunks */
+  for(uint32_t i = 0; i < load_queue.size(); i++)
+    success &= load_queue[i].first->setSoundChunk(chunks[i]);
+  load_queue.clear();
+
+  return success;
+}
+
 /*
  * Description: Process the queue of sound and music triggers.
  *
@@ -481,7 +544,8 @@ void SoundHandler::removeAll()
     delete iter->second;
   audio_sound.clear();
 
-  /* Delete queue */
+  /* Delete queues */
+  load_queue.clear();
   queue.clear();
 }
 
@@ -497,6 +561,7 @@ bool SoundHandler::removeMusic(uint32_t id)
   Sound* found = getAudioMusic(id);
   if(found != nullptr)
   {
+    unqueueLoad(found);
     delete found;
     audio_music.erase(id);
     return true;
@@ -516,6 +581,7 @@ bool SoundHandler::removeSound(uint32_t id)
   Sound* found = getAudioSound(id);
   if(found != nullptr)
   {
+    unqueueLoad(found);
     delete found;
     audio_sound.erase(id);
     return true;
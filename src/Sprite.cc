@@ -27,6 +27,9 @@ const uint8_t Sprite::kDOUBLE_DIGITS = 10;
 const double Sprite::kMAX_BRIGHTNESS = 2.0;
 const int32_t Sprite::kUNSET_SOUND_ID = -1;
 
+/* Static Implementation - see header file for descriptions */
+std::map<std::string, std::weak_ptr<Frame>> Sprite::frame_cache;
+
 /*=============================================================================
  * SPRITE CONSTRUCTORS / DESTRUCTORS
  *============================================================================*/
@@ -37,7 +40,9 @@ const int32_t Sprite::kUNSET_SOUND_ID = -1;
  * Input: none
  */
 Sprite::Sprite()
-    : animation_time{Sprite::kDEFAULT_ANIMATE_TIME},
+    : animation_clock{nullptr},
+      clock_position{-1},
+      animation_time{Sprite::kDEFAULT_ANIMATE_TIME},
       brightness{Sprite::kDEFAULT_BRIGHTNESS},
       built_texture{false},
       color_alpha{0},
@@ -50,6 +55,7 @@ Sprite::Sprite()
       color_blue{Sprite::kDEFAULT_COLOR},
       data{},
       elapsed_time{0},
+      frames_shared{},
       freeze_tail{false},
       loops{0},
       loops_to_do{0},
@@ -121,6 +127,48 @@ Sprite::~Sprite()
  * PRIVATE FUNCTIONS
  *============================================================================*/
 
+/*
+ * Description: Returns the key that identifies the build data of the sprite.
+ *              Sprites with the same key build the same frames, so the frames
+ *              are built once and shared between them.
+ *
+ * Inputs: none
+ * Output: std::string - the build data key
+ */
+std::string Sprite::getDataKey() const
+{
+  std::string key = "";
+
+  for(auto& element : data)
+  {
+    key += element.build_path_head + "|" +
+           std::to_string(element.build_frames) + "|" +
+           element.build_path_tail + "|" + std::to_string(element.build_angle);
+    for(auto& adjustment : element.build_adjustments)
+      key += "_" + adjustment;
+    key += ";";
+  }
+
+  return key;
+}
+
+/*
+ * Description: Returns if the current frame has to be composited in the sprite
+ *              texture before it is rendered. This is only the case while
+ *              transitioning between color and grey (two layers) or when
+ *              brightening (white mask). Otherwise, the frame is rendered
+ *              directly with the sprite modifications.
+ *
+ * Inputs: none
+ * Output: bool - true if the frame is composited
+ */
+bool Sprite::isComposited() const
+{
+  return (color_mode == ColorMode::GREYING ||
+          color_mode == ColorMode::COLORING ||
+          brightness > kDEFAULT_BRIGHTNESS);
+}
+
 /*
  * Description: Parses the string sequence of angle adjustments. Returns the
  *              first angle that is greater than 0 (the only used one),
@@ -153,6 +201,19 @@ uint16_t Sprite::parseAdjustments(std::vector<std::string> adjustments)
  * Output: none
  */
 void Sprite::setColorMod()
+{
+  setColorMod(texture);
+}
+
+/*
+ * Description: Sets the sprite color modification on the given texture. This
+ *              is either the sprite texture or the frame texture when it is
+ *              rendered directly.
+ *
+ * Inputs: SDL_Texture* target - the texture to modify
+ * Output: none
+ */
+void Sprite::setColorMod(SDL_Texture* target)
 {
   uint8_t red = color_red;
   uint8_t green = color_green;
@@ -190,12 +251,117 @@ void Sprite::setColorMod()
   /* Proceed to set mod based on brightness values */
   if(brightness < kDEFAULT_BRIGHTNESS)
   {
-    SDL_SetTextureColorMod(texture, brightness * red, brightness * green,
+    SDL_SetTextureColorMod(target, brightness * red, brightness * green,
                            brightness * blue);
   }
   else
   {
-    SDL_SetTextureColorMod(texture, red, green, blue);
+    SDL_SetTextureColorMod(target, red, green, blue);
+  }
+}
+
+/*
+ * Description: Drops the frames shared from the frame cache, which leaves the
+ *              sprite with no frames of its own. The frames are freed with the
+ *              last sprite holding them and expired cache entries are removed.
+ *              Called before the frame list is changed, so no other sprite
+ *              sharing the frames sees the change.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void Sprite::releaseShared()
+{
+  if(frames_shared != nullptr)
+  {
+    frames_shared.reset();
+
+    /* Remove the cache entries of frames that are gone */
+    for(auto it = frame_cache.begin(); it != frame_cache.end();)
+    {
+      if(it->second.expired())
+        it = frame_cache.erase(it);
+      else
+        ++it;
+    }
+
+    current = nullptr;
+    head = nullptr;
+    size = 0;
+    texture_update = true;
+  }
+}
+
+/*
+ * Description: Sets the color mode and transition alpha of the sprite on the
+ *              frame. The frames may be shared with other sprites, which each
+ *              hold their own mode, so this is done before the frame renders.
+ *
+ * Inputs: Frame* frame - the frame to set
+ * Output: none
+ */
+void Sprite::setFrameColor(Frame* frame)
+{
+  if(frame->getColorMode() != color_mode)
+  {
+    /* Start from the mode the transition leaves, so it is not skipped */
+    if(color_mode == ColorMode::COLORING)
+      frame->setColorMode(ColorMode::GREY);
+    else
+      frame->setColorMode(ColorMode::COLOR);
+    frame->setColorMode(color_mode);
+  }
+
+  frame->setColorAlpha(color_alpha);
+}
+
+/*
+ * Description: Shifts the sprite to the frame that the shared animation clock
+ *              points to. The frame is a pure function of the clock, so a
+ *              sprite that is not rendered does not need to be updated and
+ *              all sprites on the same clock stay in phase.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void Sprite::syncToClock()
+{
+  if(size > 1 && animation_time > 0)
+  {
+    uint32_t steps = *animation_clock / animation_time;
+    int position = steps % size;
+    if(sequence == REVERSE)
+      position = (size - position) % size;
+
+    if(position != clock_position)
+    {
+      shift(position);
+      clock_position = position;
+      loops = steps / size;
+    }
+  }
+}
+
+/*
+ * Description: Deletes the circular list of frames starting at the head. Used
+ *              to release the shared frames once the last sprite drops them.
+ *
+ * Inputs: Frame* head - the head of the frame list
+ * Output: none
+ */
+void Sprite::deleteFrames(Frame* head)
+{
+  if(head != nullptr)
+  {
+    Frame* parse = head->getNext();
+    while(parse != head && parse != nullptr)
+    {
+      Frame* next = parse->getNext();
+      delete parse;
+      parse = next;
+    }
+
+    delete head;
   }
 }
 
@@ -213,9 +379,15 @@ void Sprite::setColorMod()
  */
 void Sprite::clear()
 {
-  /* Delete all class data */
-  if(!non_unique)
+  /* Delete all class data. Shared frames go with the last sprite using them */
+  if(frames_shared != nullptr)
+  {
+    releaseShared();
+  }
+  else if(!non_unique)
+  {
     removeAll();
+  }
   SDL_DestroyTexture(texture);
 
   /* Reset variables back to blank */
@@ -228,8 +400,9 @@ void Sprite::clear()
  * Description: The copy function that is called by any copying methods in the
  *              class. Utilized by the copy constructor and the copy operator.
  *
- * Note: createTexture(SDL_Renderer*) must be called after this if you want
- *       to manipulate this sprite further.
+ * Note: Frames built from data are shared with the copy, which only holds
+ *       its own playback state. Otherwise, the head is referenced and the
+ *       copy builds from the data on first render.
  *
  * Inputs: const Sprite &source - the reference sprite class
  * Output: none
@@ -253,6 +426,14 @@ void Sprite::copySelf(const Sprite& source)
     setDirectionReverse();
 
   setRotation(source.getRotation());
+  if(source.frames_shared != nullptr)
+  {
+    clear();
+    frames_shared = source.frames_shared;
+    size = source.size;
+    built_texture = true;
+    clock_position = -1;
+  }
   setHead(source.getFirstFrame());
 
   setOpacity(source.getOpacity());
@@ -334,6 +515,10 @@ bool Sprite::addFileInformation(XmlData data, int index, SDL_Renderer* renderer,
           Helpers::split(base_path + data.getDataString(), '|');
 
       this->data.push_back(SpriteData());
+      this->data.back().build_angle = parseAdjustments(split_element);
+      if(split_element.size() > 1)
+        this->data.back().build_adjustments.assign(split_element.begin() + 1,
+                                                   split_element.end());
 
       if(split_path.size() == 3)
       {
@@ -357,14 +542,17 @@ bool Sprite::addFileInformation(XmlData data, int index, SDL_Renderer* renderer,
 }
 
 /*
- * Description: Generates the baseline texture for all handling.
+ * Description: Generates the texture the current frame is composited in, when
+ *              the sprite needs one (see isComposited()). Sprites rendering
+ *              the frames directly skip it, so copies cost no texture memory.
  *
  * Inputs: SDL_Renderer* renderer - the rendering engine
  * Output: none
  */
 void Sprite::createTexture(SDL_Renderer* renderer)
 {
-  if(head != nullptr && head->isTextureSet() && texture == nullptr)
+  if(head != nullptr && head->isTextureSet() && texture == nullptr &&
+     isComposited())
   {
     texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888,
                                 SDL_TEXTUREACCESS_TARGET, head->getWidth(),
@@ -372,6 +560,7 @@ void Sprite::createTexture(SDL_Renderer* renderer)
     SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
     setColorMod();
     setOpacity(opacity);
+    texture_update = true;
   }
 }
 
@@ -665,7 +854,9 @@ uint8_t Sprite::getTempColorBlue() const
 
 /*
  * Description: Inserts the image into the sprite sequence at the given
- *              position based on the given string path.
+ *              position based on the given string path. If the frames are
+ *              shared with other sprites, this sprite drops them first and the
+ *              image starts a new sequence of its own.
  *
  * Inputs: std::string path - the path to the image to add
  *         SDL_Renderer* renderer - the rendering engine pointer
@@ -678,9 +869,12 @@ Frame* Sprite::insert(std::string path, SDL_Renderer* renderer, int position,
                       uint16_t angle, bool no_warnings)
 {
   Frame* next_frame;
-  Frame* new_frame;
+  Frame* new_frame = NULL;
   Frame* previous_frame;
 
+  /* Shared frames are not changed - this sprite starts its own list */
+  releaseShared();
+
   /* Only add if the size is within the bounds of the sprite */
   if(size == 0)
   {
@@ -742,28 +936,13 @@ Frame* Sprite::insertFirst(std::string path, SDL_Renderer* renderer,
 
     if(head->isTextureSet())
     {
-      /* First set the rendering texture, if unset */
-      if(texture == NULL)
-      {
-        texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888,
-                                    SDL_TEXTUREACCESS_TARGET, head->getWidth(),
-                                    head->getHeight());
-        SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
-        setColorMod();
-        setOpacity(opacity);
-      }
-
-      /* Only proceed with finishing if the rendering texture could be set */
-      if(texture != NULL)
-      {
-        head->setNext(head);
-        head->setPrevious(head);
-        current = head;
-        size = 1;
-        texture_update = true;
+      head->setNext(head);
+      head->setPrevious(head);
+      current = head;
+      size = 1;
+      texture_update = true;
 
-        return head;
-      }
+      return head;
     }
 
     delete head;
@@ -942,9 +1121,24 @@ bool Sprite::isFramesSet() const
   return (head != nullptr);
 }
 
+/*
+ * Description: Returns if the sprite has been built. A sprite with data that
+ *              is stored to be loaded later (or was unloaded) is not loaded.
+ *
+ * Inputs: none
+ * Output: bool - true if the frames are built
+ */
+bool Sprite::isLoaded() const
+{
+  return built_texture || data.empty();
+}
+
 /*
  * Description: Loads the sprite data from data into the
  *              Sprite class constructing the frames/textures as required.
+ *              If another sprite already built the same data, its frames are
+ *              shared instead. Frames built into an empty sprite are offered
+ *              for sharing in turn.
  *
  * Inputs: none
  * Output: bool - true if the data could have been loaded
@@ -953,23 +1147,69 @@ bool Sprite::loadData(SDL_Renderer* renderer)
 {
   bool success = true;
 
+  if(renderer && !built_texture && head == nullptr && data.size() > 0)
+  {
+    auto cached = frame_cache.find(getDataKey());
+    if(cached != frame_cache.end())
+    {
+      frames_shared = cached->second.lock();
+      if(frames_shared == nullptr)
+        frame_cache.erase(cached);
+    }
+
+    if(frames_shared != nullptr)
+    {
+      head = frames_shared.get();
+      size = 1;
+      for(Frame* parse = head->getNext(); parse != head && parse != nullptr;
+          parse = parse->getNext())
+        size++;
+
+      setAtFirst();
+      clock_position = -1;
+      built_texture = true;
+    }
+  }
+
   if(renderer && !built_texture)
   {
+    bool shareable = (head == nullptr);
+
     for(auto& element : data)
     {
+      std::vector<Frame*> new_frames;
+
       if(element.build_path_head != "" && element.build_path_tail == "")
       {
-        insertTail(element.build_path_head, renderer);
-        success = true;
+        Frame* new_frame = insertTail(element.build_path_head, renderer,
+                                      element.build_angle);
+        if(new_frame != nullptr)
+          new_frames.push_back(new_frame);
       }
       else if(element.build_path_head != "" && element.build_path_tail != "")
       {
-        insertSequence(element.build_path_head, element.build_frames,
-                       element.build_path_tail, renderer);
-
-        success = true;
+        new_frames = insertSequence(element.build_path_head,
+                                    element.build_frames,
+                                    element.build_path_tail, renderer,
+                                    element.build_angle);
       }
+
+      /* Apply the image adjustments to the new frames */
+      if(element.build_adjustments.size() > 0)
+        for(auto& new_frame : new_frames)
+          if(new_frame != nullptr)
+            success &= new_frame->execImageAdjustments(
+                element.build_adjustments);
     }
+
+    /* Hand the new frames to the cache, for the next sprite of the data */
+    if(shareable && head != nullptr && data.size() > 0)
+    {
+      frames_shared = std::shared_ptr<Frame>(head, deleteFrames);
+      frame_cache[getDataKey()] = frames_shared;
+    }
+
+    clock_position = -1;
   }
 
   built_texture = true;
@@ -978,7 +1218,41 @@ bool Sprite::loadData(SDL_Renderer* renderer)
 }
 
 /*
- * Description: Removes the frame in the sequence at the given position
+ * Description: Releases the frames and the render texture of a sprite that was
+ *              built from stored data, so the memory can be reclaimed. The
+ *              next loadData() (or render) rebuilds it from the same data.
+ *              Frames shared from data are freed once no sprite holds them.
+ *              Non-unique sprites or ones with no stored data are left as is.
+ *
+ * Inputs: none
+ * Output: bool - true if the sprite was unloaded
+ */
+bool Sprite::unloadData()
+{
+  if(built_texture && data.size() > 0 &&
+     (frames_shared != nullptr || !non_unique))
+  {
+    if(frames_shared != nullptr)
+      releaseShared();
+    else
+    {
+      removeAll();
+    }
+    SDL_DestroyTexture(texture);
+    texture = nullptr;
+
+    built_texture = false;
+    clock_position = -1;
+    return true;
+  }
+
+  return false;
+}
+
+/*
+ * Description: Removes the frame in the sequence at the given position. If the
+ *              frames are shared with other sprites, they are left intact and
+ *              this sprite drops all of them instead.
  *
  * Inputs: int position - the position of the frame to remove in the linked
  *                        list.
@@ -990,6 +1264,14 @@ bool Sprite::remove(int position)
   Frame* next_frame;
   Frame* previous_frame;
 
+  /* Shared frames are not deleted - they are all dropped from this sprite */
+  if(frames_shared != nullptr)
+  {
+    bool valid = (position < size && position >= 0);
+    releaseShared();
+    return valid;
+  }
+
   /* Only remove if the position exists within the size boundaries */
   if(position < size && position >= 0)
   {
@@ -1075,11 +1357,12 @@ void Sprite::resetLoops()
   loops = 0;
 }
 
-/* Render the texture to the given renderer with the given parameters */
 /*
  * Description: Renders the sprite data, utilizing a x and y coordinate, and a
  *              width and height value, if relevant. If width and height aren't
- *              entered, it uses the texture size.
+ *              entered, it uses the texture size. The frame is rendered
+ *              directly with the sprite color and opacity modifications unless
+ *              it needs compositing in the sprite texture first.
  *
  * Inputs: SDL_Renderer* renderer - the rendering engine for the sprite texture
  *         int x - the x coordinate on the painted viewport
@@ -1095,18 +1378,64 @@ bool Sprite::render(SDL_Renderer* renderer, int x, int y, int w, int h)
 
   if(current != nullptr && renderer != nullptr)
   {
+    /* Clock driven sprites catch up on the frame only when drawn */
+    if(animation_clock != nullptr)
+      syncToClock();
+
+    SDL_Rect rect;
+    rect.x = x;
+    rect.y = y;
+    rect.h = current->getHeight();
+    rect.w = current->getWidth();
+
+    /* Use parameter height and width if both are viable */
+    if(h > 0 && w > 0)
+    {
+      rect.h = h;
+      rect.w = w;
+    }
+
+    /* Render the frame directly, modded for this sprite and then restored */
+    if(!isComposited())
+    {
+      SDL_Texture* frame_texture = current->getTexture(
+          color_mode == ColorMode::GREY && current->isTextureSet(true));
+      uint8_t frame_alpha = current->getAlpha();
+
+      SDL_SetTextureBlendMode(frame_texture, SDL_BLENDMODE_BLEND);
+      SDL_SetTextureAlphaMod(frame_texture, opacity * frame_alpha / 255);
+      setColorMod(frame_texture);
+
+      bool success = (SDL_RenderCopyEx(renderer, frame_texture,
+                                       getSourceRect(), &rect, rotation_angle,
+                                       NULL, current->getFlip()) == 0);
+
+      SDL_SetTextureAlphaMod(frame_texture, frame_alpha);
+      SDL_SetTextureColorMod(frame_texture, kDEFAULT_COLOR, kDEFAULT_COLOR,
+                             kDEFAULT_COLOR);
+      return success;
+    }
+
     /* Proceed to update the running texture if it's changed */
+    createTexture(renderer);
     if(texture_update || color_mode == ColorMode::GREYING ||
        color_mode == ColorMode::COLORING)
     {
       SDL_Texture* previous_renderer = SDL_GetRenderTarget(renderer);
 
+      /* Switching targets resets the render scale (the map zoom). It is
+       * only restored by SDL when returning to the screen, so keep it to
+       * restore on any target, such as a snapshot capture */
+      float scale_x = 1.0;
+      float scale_y = 1.0;
+      SDL_RenderGetScale(renderer, &scale_x, &scale_y);
+
       SDL_SetRenderTarget(renderer, texture);
       SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
       SDL_RenderClear(renderer);
 
       /* Render current frame */
-      current->setColorAlpha(color_alpha);
+      setFrameColor(current);
       current->render(renderer, 0, 0, 0, 0, getSourceRect(), true);
 
       /* Render white mask, if relevant */
@@ -1123,22 +1452,10 @@ bool Sprite::render(SDL_Renderer* renderer, int x, int y, int w, int h)
 
       /* Release the renderer and end the update */
       SDL_SetRenderTarget(renderer, previous_renderer);
+      SDL_RenderSetScale(renderer, scale_x, scale_y);
       texture_update = false;
     }
 
-    SDL_Rect rect;
-    rect.x = x;
-    rect.y = y;
-    rect.h = current->getHeight();
-    rect.w = current->getWidth();
-
-    /* Use parameter height and width if both are viable */
-    if(h > 0 && w > 0)
-    {
-      rect.h = h;
-      rect.w = w;
-    }
-
     /* Render and return status */
     return (SDL_RenderCopyEx(renderer, texture, NULL, &rect, rotation_angle,
                              NULL, SDL_FLIP_NONE) == 0);
@@ -1162,6 +1479,21 @@ void Sprite::revertColorBalance()
   setColorMod();
 }
 
+/*
+ * Description: Sets the shared animation clock. When set, the frame is no
+ *              longer advanced in update() and is instead computed from the
+ *              clock when the sprite is rendered. Set to nullptr to return to
+ *              update driven animation.
+ *
+ * Inputs: const uint32_t* clock - the clock, in ms. Must outlive the sprite
+ * Output: none
+ */
+void Sprite::setAnimationClock(const uint32_t* clock)
+{
+  animation_clock = clock;
+  clock_position = -1;
+}
+
 /*
  * Description: Sets the animation time between frame changes. Gets called
  *              from the update call below for updating the frames in the
@@ -1320,7 +1652,8 @@ bool Sprite::setColorMode(ColorMode mode)
 {
   bool set = false;
 
-  if(mode != color_mode && head != nullptr)
+  /* Unbuilt sprites hold the mode, to be applied to the frames on load */
+  if(mode != color_mode && (head != nullptr || !isLoaded()))
   {
     /* Color enabled mode - default */
     if(mode == ColorMode::COLOR ||
@@ -1359,15 +1692,7 @@ bool Sprite::setColorMode(ColorMode mode)
         color_alpha = 0;
     }
 
-    /* Update all frames with the new color mode values */
-    Frame* parse = head;
-    do
-    {
-      parse->setColorMode(color_mode);
-      parse->setColorAlpha(color_alpha);
-      parse = parse->getNext();
-    } while(parse != head && parse != nullptr);
-
+    /* The frames take on the mode when rendered (see setFrameColor()) */
     texture_update = true;
   }
 
@@ -1519,6 +1844,10 @@ void Sprite::setSoundID(int32_t id)
  */
 void Sprite::setSourceRect(SDL_Rect rect)
 {
+  if(!src_rect_use || rect.x != src_rect.x || rect.y != src_rect.y ||
+     rect.w != src_rect.w || rect.h != src_rect.h)
+    texture_update = true;
+
   this->src_rect = rect;
   this->src_rect_use = true;
 }
@@ -1685,6 +2014,9 @@ bool Sprite::switchDirection()
  */
 void Sprite::unsetSourceRect()
 {
+  if(src_rect_use)
+    texture_update = true;
+
   src_rect_use = false;
 }
 
@@ -1731,7 +2063,8 @@ bool Sprite::update(int cycle_time, bool skip_head, bool color_only)
     }
 
     /* Start by updating the animation and shifting, if necessary */
-    if(!color_only && size > 1 && cycle_time > 0 && animation_time > 0)
+    if(!color_only && animation_clock == nullptr && size > 1 &&
+       cycle_time > 0 && animation_time > 0)
     {
       elapsed_time += cycle_time;
       if(elapsed_time > animation_time)
@@ -9,8 +9,15 @@
 #include "Text.h"
 
 /* Constant Implementation - see header file for descriptions */
+const uint16_t Text::kCACHE_MAX = 4096;
 const uint8_t Text::kDEFAULT_ALPHA = 255;
 
+/* Static Implementation - see header file for descriptions */
+std::unordered_map<string, int> Text::cache_sizes;
+std::unordered_map<string, vector<string>> Text::cache_lines;
+std::unordered_map<string, vector<vector<vector<pair<string, TextProperty>>>>>
+    Text::cache_lines_property;
+
 /*=============================================================================
  * CONSTRUCTORS / DESTRUCTORS
  *============================================================================*/
@@ -302,7 +309,7 @@ bool Text::setText(SDL_Renderer* renderer,
   {
     int orig_style = TTF_GetFontStyle(render_font);
     int space_width = 0;
-    TTF_SizeText(render_font, " ", &space_width, nullptr);
+    sizeText(render_font, " ", &space_width);
     if(length < 0)
       length = Text::countLength(text);
 
@@ -335,76 +342,68 @@ bool Text::setText(SDL_Renderer* renderer,
     /* Restore the font style */
     TTF_SetFontStyle(render_font, orig_style);
 
-    /* Process the surface stack */
+    /* Size the line from the surface stack */
     int max_height = 0;
-    vector<pair<SDL_Texture*, SDL_Point>> text_textures;
     int total_width = 0;
     for(uint32_t i = 0; i < text_surfaces.size(); i++)
     {
-      /* -- Valid surface: convert to texture -- */
       if(text_surfaces[i] != nullptr)
       {
-        SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer,
-                                                          text_surfaces[i]);
-        if(texture != nullptr)
-        {
-          text_textures.push_back(pair<SDL_Texture*, SDL_Point>(
-                         texture, {text_surfaces[i]->w, text_surfaces[i]->h}));
-          total_width += text_surfaces[i]->w;
-          if(text_surfaces[i]->h > max_height)
-            max_height = text_surfaces[i]->h;
-        }
+        total_width += text_surfaces[i]->w;
+        if(text_surfaces[i]->h > max_height)
+          max_height = text_surfaces[i]->h;
       }
-      /* -- Invalid surface: convert to space -- */
       else
       {
-        text_textures.push_back(pair<SDL_Texture*, SDL_Point>(
-                                                 nullptr, {space_width, 1}));
         total_width += space_width;
       }
     }
 
-    /* If valid width, proceed with creation of one texture */
-    if(total_width > 0)
+    /* If valid width, copy the runs side by side into one surface and upload
+     * it as the texture. The runs do not overlap, so each is copied without
+     * blending */
+    if(total_width > 0 && max_height > 0)
     {
-      /* Combine into one large texture */
-      SDL_Texture* orig_render = SDL_GetRenderTarget(renderer);
-      SDL_Texture* texture = SDL_CreateTexture(renderer,
-                                               SDL_PIXELFORMAT_RGBA8888,
-                                               SDL_TEXTUREACCESS_TARGET,
-                                               total_width, max_height);
-      int x_ref = 0;
-      SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
-      SDL_SetRenderTarget(renderer, texture);
-      SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
-      SDL_RenderClear(renderer);
-      for(uint32_t i = 0; i < text_textures.size(); i++)
+      SDL_Surface* line_surface = SDL_CreateRGBSurface(
+          0, total_width, max_height, 32, 0x00ff0000, 0x0000ff00, 0x000000ff,
+          0xff000000);
+      if(line_surface != nullptr)
       {
-        if(text_textures[i].first != nullptr)
+        int x_ref = 0;
+        for(uint32_t i = 0; i < text_surfaces.size(); i++)
+        {
+          if(text_surfaces[i] != nullptr)
+          {
+            SDL_Rect rect{x_ref, 0, text_surfaces[i]->w, text_surfaces[i]->h};
+            SDL_SetSurfaceBlendMode(text_surfaces[i], SDL_BLENDMODE_NONE);
+            SDL_BlitSurface(text_surfaces[i], nullptr, line_surface, &rect);
+            x_ref += text_surfaces[i]->w;
+          }
+          else
+          {
+            x_ref += space_width;
+          }
+        }
+
+        SDL_Texture* texture =
+            SDL_CreateTextureFromSurface(renderer, line_surface);
+        SDL_FreeSurface(line_surface);
+
+        /* Assign the new texture */
+        if(texture != nullptr)
         {
-          SDL_Rect rect{x_ref, 0, text_textures[i].second.x,
-                        text_textures[i].second.y};
-          SDL_RenderCopy(renderer, text_textures[i].first, nullptr, &rect);
+          unsetTexture();
+          alpha = kDEFAULT_ALPHA;
+          this->texture = texture;
+          height = max_height;
+          width = total_width;
+          setAlpha(alpha);
+          success = true;
         }
-        x_ref += text_textures[i].second.x;
       }
-      SDL_SetRenderTarget(renderer, orig_render);
-
-      /* Assign the new texture */
-      unsetTexture();
-      alpha = kDEFAULT_ALPHA;
-      this->texture = texture;
-      height = max_height;
-      width = total_width;
-      setAlpha(alpha);
-      success = true;
     }
 
-    /* Clean-up surfaces and textures created */
-    for(uint32_t i = 0; i < text_textures.size(); i++)
-      if(text_textures[i].first != nullptr)
-        SDL_DestroyTexture(text_textures[i].first);
-    text_textures.clear();
+    /* Clean-up surfaces created */
     for(uint32_t i = 0; i < text_surfaces.size(); i++)
       if(text_surfaces[i] != nullptr)
         SDL_FreeSurface(text_surfaces[i]);
@@ -440,6 +439,78 @@ void Text::unsetTexture()
   texture = NULL;
 }
 
+/*============================================================================
+ * PRIVATE STATIC FUNCTIONS
+ *===========================================================================*/
+
+/*
+ * Description: Returns the cache key of the font. The key is built from the
+ *              face and metrics instead of the pointer, so a font that is
+ *              closed and another opened at the same address never share
+ *              cached sizes. The current style is part of the key.
+ *
+ * Inputs: TTF_Font* font - the font reference pointer (must be non-NULL)
+ * Output: string - the key of the font, as it is currently styled
+ */
+string Text::fontKey(TTF_Font* font)
+{
+  const char* family = TTF_FontFaceFamilyName(font);
+  const char* face = TTF_FontFaceStyleName(font);
+
+  return string(family != nullptr ? family : "") + "/" +
+         (face != nullptr ? face : "") + "/" +
+         to_string(TTF_FontHeight(font)) + "/" +
+         to_string(TTF_FontAscent(font)) + "/" +
+         to_string(TTF_GetFontStyle(font)) + "/";
+}
+
+/*
+ * Description: Returns the cache key of a wrapped string, for the split line
+ *              caches.
+ *
+ * Inputs: TTF_Font* font - the font reference pointer (must be non-NULL)
+ *         const string& text - the text being split
+ *         int line_width - the width the text is split to
+ *         int elide_count - the line count the text is elided at
+ * Output: string - the key of the split
+ */
+string Text::lineKey(TTF_Font* font, const string& text, int line_width,
+                     int elide_count)
+{
+  return fontKey(font) + to_string(line_width) + "/" +
+         to_string(elide_count) + "/" + text;
+}
+
+/*
+ * Description: Measures the width of the text in the font, as currently
+ *              styled. Each string is only measured by the font engine once
+ *              and then read from the cache. The cache is dropped when full.
+ *
+ * Inputs: TTF_Font* font - the font reference pointer (must be non-NULL)
+ *         const string& text - the text to measure
+ *         int* width - the measured width, in pixels
+ * Output: bool - true if the text was measured
+ */
+bool Text::sizeText(TTF_Font* font, const string& text, int* width)
+{
+  string key = fontKey(font) + text;
+
+  auto found = cache_sizes.find(key);
+  if(found != cache_sizes.end())
+  {
+    *width = found->second;
+    return true;
+  }
+
+  if(TTF_SizeText(font, text.c_str(), width, nullptr) != 0)
+    return false;
+
+  if(cache_sizes.size() >= kCACHE_MAX)
+    cache_sizes.clear();
+  cache_sizes[key] = *width;
+  return true;
+}
+
 /*============================================================================
  * PUBLIC STATIC FUNCTIONS
  *===========================================================================*/
@@ -482,7 +553,14 @@ int Text::countLength(vector<vector<pair<string, TextProperty>>> text)
  */
 TTF_Font* Text::createFont(string font_path, int font_size, int font_style)
 {
-  TTF_Font* new_font = TTF_OpenFont(font_path.c_str(), font_size);
+  TTF_Font* new_font = nullptr;
+
+  /* The font reads from the asset pack, if packed */
+  SDL_RWops* packed = AssetPack::openFile(font_path);
+  if(packed != nullptr)
+    new_font = TTF_OpenFontRW(packed, 1, font_size);
+  else
+    new_font = TTF_OpenFont(font_path.c_str(), font_size);
 
   /* If the font creation is successful, set the style */
   if(new_font != NULL)
@@ -731,6 +809,60 @@ vector<pair<string, TextProperty>> Text::parseHtml(string text)
   return result;
 }
 
+/*
+ * Description: Measures a line processed by splitLineProperty() and returns
+ *              the pixel width that is visible for each count of characters,
+ *              laid out the same as setText(). A line that is rendered in full
+ *              can then be revealed character by character by clipping to
+ *              these widths instead of re-rendering the partial line.
+ *
+ * Inputs: TTF_Font* font - the font reference pointer (must be non-NULL)
+ *         vector<vector<pair<string, TextProperty>>> line - the line of words
+ * Output: vector<int> - the widths, indexed by visible character count. Empty
+ *                       if the font sizing failed
+ */
+vector<int> Text::revealWidths(TTF_Font* font,
+                       const vector<vector<pair<string, TextProperty>>>& line)
+{
+  int orig_style = TTF_GetFontStyle(font);
+  int space_width = 0;
+  bool success = sizeText(font, " ", &space_width);
+  int width = 0;
+  vector<int> widths;
+  int x_ref = 0;
+
+  widths.push_back(0);
+  for(uint32_t i = 0; success && i < line.size(); i++)
+  {
+    for(uint32_t j = 0; success && j < line[i].size(); j++)
+    {
+      const string& str = line[i][j].first;
+      TTF_SetFontStyle(font, line[i][j].second.style);
+      width = 0;
+
+      /* Each partial sub-word is its own surface, starting at x_ref */
+      for(uint32_t k = 1; success && k <= str.size(); k++)
+      {
+        success &= sizeText(font, str.substr(0, k), &width);
+        widths.push_back(x_ref + width);
+      }
+      x_ref += width;
+    }
+
+    /* Space between words */
+    if(i != (line.size() - 1))
+    {
+      x_ref += space_width;
+      widths.push_back(x_ref);
+    }
+  }
+  TTF_SetFontStyle(font, orig_style);
+
+  if(!success)
+    widths.clear();
+  return widths;
+}
+
 /*
  * Description: Splits a line into the appropriate widths, based on the
  *              rendering font. This will seg fault if the font is NULL or
@@ -750,6 +882,12 @@ vector<pair<string, TextProperty>> Text::parseHtml(string text)
 vector<string> Text::splitLine(TTF_Font* font, string text,
                                int line_width, int elide_count)
 {
+  /* Repeated splits are read from the cache */
+  string key = lineKey(font, text, line_width, elide_count);
+  auto found = cache_lines.find(key);
+  if(found != cache_lines.end())
+    return found->second;
+
   int dot_width = 0;
   vector<string> line_stack;
   int space_width = 0;
@@ -761,11 +899,11 @@ vector<string> Text::splitLine(TTF_Font* font, string text,
   /* Get the widths of all words */
   for(uint16_t i = 0; i < words.size(); i++)
   {
-    success &= (TTF_SizeText(font, words[i].c_str(), &width, NULL) == 0);
+    success &= sizeText(font, words[i], &width);
     word_widths.push_back(width);
   }
-  success &= (TTF_SizeText(font, " ", &space_width, NULL) == 0);
-  success &= (TTF_SizeText(font, ".", &dot_width, NULL) == 0);
+  success &= sizeText(font, " ", &space_width);
+  success &= sizeText(font, ".", &dot_width);
 
   /* Proceed if font sizing was successful */
   if(success)
@@ -832,6 +970,10 @@ vector<string> Text::splitLine(TTF_Font* font, string text,
     /* Append the final line if not null */
     if(!line.empty())
       line_stack.push_back(line);
+
+    if(cache_lines.size() >= kCACHE_MAX)
+      cache_lines.clear();
+    cache_lines[key] = line_stack;
   }
 
   return line_stack;
@@ -855,7 +997,22 @@ vector<vector<vector<pair<string, TextProperty>>>>
          Text::splitLineProperty(TTF_Font* font, string text, int line_width,
                                  int elide_count)
 {
-  return splitLineProperty(font, line_width, parseHtml(text), elide_count);
+  /* Repeated splits are read from the cache */
+  string key = lineKey(font, text, line_width, elide_count);
+  auto found = cache_lines_property.find(key);
+  if(found != cache_lines_property.end())
+    return found->second;
+
+  auto line_stack = splitLineProperty(font, line_width, parseHtml(text),
+                                      elide_count);
+  if(!line_stack.empty())
+  {
+    if(cache_lines_property.size() >= kCACHE_MAX)
+      cache_lines_property.clear();
+    cache_lines_property[key] = line_stack;
+  }
+
+  return line_stack;
 }
 
 /*
@@ -889,10 +1046,10 @@ vector<vector<vector<pair<string, TextProperty>>>>
   /* Space width */
   if(elide_count > 0)
   {
-    success &= (TTF_SizeText(font, ".", &elide_width, NULL) == 0);
+    success &= sizeText(font, ".", &elide_width);
     elide_width *= 3;
   }
-  success &= (TTF_SizeText(font, " ", &space_width, NULL) == 0);
+  success &= sizeText(font, " ", &space_width);
 
   /* Get the split and width of all words */
   int orig_style = TTF_GetFontStyle(font);
@@ -924,8 +1081,7 @@ vector<vector<vector<pair<string, TextProperty>>>>
           word.push_back(pair<string, TextProperty>(word_split[j],
                                                     text_set[i].second));
           TTF_SetFontStyle(font, text_set[i].second.style);
-          success &=
-            (TTF_SizeText(font, word_split[j].c_str(), &width, nullptr) == 0);
+          success &= sizeText(font, word_split[j], &width);
           width_total += width;
 
           /* If there are words remaining, append the current */
@@ -0,0 +1,80 @@
+/*******************************************************************************
+ * Class Name: Timeline
+ * Date Created: October 19, 2026
+ * Inheritance: none
+ * Description: The startup timeline. Each phase of the start up sequence is
+ *              marked as it completes and the full timeline, up to the first
+ *              render of the title screen, is reported once on every run.
+ *              Marks are only made from the main thread.
+ ******************************************************************************/
+#include "Timeline.h"
+
+/* Constant Implementation - see header file for descriptions */
+const uint8_t Timeline::kNAME_WIDTH = 24;
+
+/* Static Implementation - see header file for descriptions */
+bool Timeline::active = true;
+double Timeline::last = 0.0;
+std::vector<std::pair<std::string, double>> Timeline::phases;
+Timer Timeline::start;
+
+/*=============================================================================
+ * PUBLIC FUNCTIONS
+ *============================================================================*/
+
+/*
+ * Description: Returns if the timeline is still recording. It stops once it
+ *              has been reported.
+ *
+ * Inputs: none
+ * Output: bool - true if still recording
+ */
+bool Timeline::isActive()
+{
+  return active;
+}
+
+/*
+ * Description: Marks the end of a phase. The phase is the time since the
+ *              previous mark, or the start of the run for the first.
+ *
+ * Inputs: const std::string& phase - the name of the phase that finished
+ * Output: none
+ */
+void Timeline::mark(const std::string& phase)
+{
+  if(active)
+  {
+    double now = start.elapsed();
+    phases.push_back(std::make_pair(phase, now - last));
+    last = now;
+  }
+}
+
+/*
+ * Description: Reports each phase and the total time from the start of the
+ *              run to the last mark. The timeline stops recording after.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void Timeline::report()
+{
+  if(active)
+  {
+    std::cout << "--" << std::endl << "Startup Timeline" << std::endl;
+    for(auto& phase : phases)
+      std::cout << "  " << std::left << std::setw(kNAME_WIDTH) << phase.first
+                << std::right << std::fixed << std::setprecision(1)
+                << std::setw(8) << phase.second * 1000.0 << " ms" << std::endl;
+    std::cout << "  " << std::left << std::setw(kNAME_WIDTH)
+              << "Time to title screen" << std::right << std::setw(8)
+              << last * 1000.0 << " ms" << std::endl
+              << "--" << std::endl;
+    std::cout.unsetf(std::ios_base::floatfield);
+    std::cout << std::setprecision(6);
+
+    active = false;
+    phases.clear();
+  }
+}
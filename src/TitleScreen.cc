@@ -14,6 +14,10 @@
  * TITLE_BACKGROUND
  *============================================================================*/
 
+/* Constant Implementation - see header file for descriptions */
+const std::string TitleBackground::kBACKGROUND =
+    "assets/images/backgrounds/title.png";
+
 /* Construct the TitleBackground Class */
 TitleBackground::TitleBackground()
 {
@@ -48,8 +52,7 @@ void TitleBackground::buildSprites(Options* config, SDL_Renderer* renderer)
 {
   if(config && renderer)
   {
-    background.insertFirst(
-        config->getBasePath() + "assets/images/backgrounds/title.png", renderer);
+    background.insertFirst(config->getBasePath() + kBACKGROUND, renderer);
 
     title.setFont(config->getFontTTF(FontName::TITLE_MAIN_HEADER));
     title.setText(renderer, "Real Title 2: End of the Seven Seas", {255, 255, 255, 255});